@@ -63,4 +63,18 @@ static void FutureMultiThread2(benchmark::State& state) {
         benchmark::DoNotOptimize(value);
     }
 }
-BENCHMARK(FutureMultiThread2);
\ No newline at end of file
+BENCHMARK(FutureMultiThread2);
+static void ThreadPoolRun(benchmark::State& state) {
+    AThreadPool tp(1);
+    std::array<std::uint64_t, 4> payload{};
+    for (auto _ : state) {
+        AFuture<> f;
+        // the capture fits into AThreadPool::task inplace storage; no dynamic allocation for the task itself.
+        tp.run([f, payload] {
+            benchmark::DoNotOptimize(payload);
+            f.supplyValue();
+        });
+        f.wait();
+    }
+}
+BENCHMARK(ThreadPoolRun);
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "AUI/Common/AFlatHashMap.h"
+#include "AUI/Common/AFlatMap.h"
+#include "AUI/Common/AMap.h"
+#include "AUI/Common/AString.h"
+#include "AUI/Common/AVector.h"
+
+namespace {
+// resembles translation keys looked up by AI18n.
+AVector<AString> makeKeys(std::size_t count) {
+    AVector<AString> keys;
+    keys.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        keys << "aui.component.label" + AString::number(i);
+    }
+    return keys;
+}
+
+AVector<int> makeIntKeys(std::size_t count) {
+    AVector<int> keys;
+    std::mt19937 random(0);
+    for (std::size_t i = 0; i < count; ++i) {
+        keys << int(random());
+    }
+    return keys;
+}
+}
+
+template<typename Map>
+static void MapFindString(benchmark::State& state) {
+    auto keys = makeKeys(state.range(0));
+    Map map;
+    for (const auto& key : keys) {
+        map[key] = key;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(0));
+    for (auto _ : state) {
+        for (const auto& key : keys) {
+            benchmark::DoNotOptimize(map.find(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK_TEMPLATE(MapFindString, AMap<AString, AString>)->Arg(16)->Arg(1024);
+BENCHMARK_TEMPLATE(MapFindString, AUnorderedMap<AString, AString>)->Arg(16)->Arg(1024);
+BENCHMARK_TEMPLATE(MapFindString, AFlatHashMap<AString, AString>)->Arg(16)->Arg(1024);
+BENCHMARK_TEMPLATE(MapFindString, AFlatMap<AString, AString>)->Arg(16)->Arg(1024);
+
+template<typename Map>
+static void MapFindInt(benchmark::State& state) {
+    auto keys = makeIntKeys(state.range(0));
+    Map map;
+    for (auto key : keys) {
+        map[key] = key;
+    }
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(0));
+    for (auto _ : state) {
+        for (auto key : keys) {
+            benchmark::DoNotOptimize(map.find(key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK_TEMPLATE(MapFindInt, AMap<int, int>)->Arg(16)->Arg(65536);
+BENCHMARK_TEMPLATE(MapFindInt, AUnorderedMap<int, int>)->Arg(16)->Arg(65536);
+BENCHMARK_TEMPLATE(MapFindInt, AFlatHashMap<int, int>)->Arg(16)->Arg(65536);
+BENCHMARK_TEMPLATE(MapFindInt, AFlatMap<int, int>)->Arg(16)->Arg(65536);
+
+template<typename Map>
+static void MapInsertInt(benchmark::State& state) {
+    auto keys = makeIntKeys(state.range(0));
+    for (auto _ : state) {
+        Map map;
+        for (auto key : keys) {
+            map[key] = key;
+        }
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK_TEMPLATE(MapInsertInt, AMap<int, int>)->Arg(65536);
+BENCHMARK_TEMPLATE(MapInsertInt, AUnorderedMap<int, int>)->Arg(65536);
+BENCHMARK_TEMPLATE(MapInsertInt, AFlatHashMap<int, int>)->Arg(65536);
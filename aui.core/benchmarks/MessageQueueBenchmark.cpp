@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+#include "AUI/Util/AMessageQueue.h"
+#include "AUI/Util/ALockFreeMessageQueue.h"
+
+template<typename Queue>
+static void MessageQueueEnqueue(benchmark::State& state) {
+    static Queue* queue;
+    static std::atomic_bool done;
+    static std::thread* consumer;
+    if (state.thread_index() == 0) {
+        queue = new Queue;
+        done = false;
+        consumer = new std::thread([] {
+            while (!done) {
+                queue->processMessages();
+            }
+            queue->processMessages();
+        });
+    }
+    for (auto _ : state) {
+        queue->enqueue([] {});
+    }
+    if (state.thread_index() == 0) {
+        done = true;
+        consumer->join();
+        delete consumer;
+        delete queue;
+    }
+}
+BENCHMARK(MessageQueueEnqueue<AMessageQueue<>>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(MessageQueueEnqueue<ALockFreeMessageQueue<>>)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,102 @@
+#include <benchmark/benchmark.h>
+#include <AUI/Common/AObject.h>
+#include "AUI/Common/ASignal.h"
+#include "AUI/Util/Assert.h"
+#include "AUI/Util/kAUI.h"
+
+using namespace std::chrono_literals;
+
+static constexpr auto TEST_VALUE = 228;
+
+class Emitter: public AObject {
+public:
+    void makeSignal() {
+        emit test(TEST_VALUE);
+    }
+
+signals:
+    emits<int> test;
+};
+
+class Receiver: public AObject {
+public:
+    void receive(int v) {
+        AUI_ASSERT(v == TEST_VALUE);
+        benchmark::DoNotOptimize(v);
+    }
+};
+
+
+static void SignalSlot(benchmark::State& state) {
+    auto emitter = _new<Emitter>();
+    auto receiver = _new<Receiver>();
+    AObject::connect(emitter->test, slot(receiver)::receive);
+
+    for (auto _ : state) {
+        emitter->makeSignal();
+    }
+}
+BENCHMARK(SignalSlot);
+
+static void SignalSlotProperty(benchmark::State& state) {
+    // property-like emission: no sender object, several receivers on the same thread.
+    emits<int> signal;
+    auto receivers = std::vector<_<Receiver>>(3);
+    for (auto& receiver : receivers) {
+        receiver = _new<Receiver>();
+        AObject::connect(signal, slot(receiver)::receive);
+    }
+    // like views, which accept slot calls on their thread only.
+    receivers.front()->setSlotsCallsOnlyOnMyThread(true);
+
+    for (auto _ : state) {
+        signal(TEST_VALUE).invokeSignal(nullptr);
+    }
+}
+BENCHMARK(SignalSlotProperty);
+
+static void SignalSlotMultithreaded(benchmark::State& state) {
+    // each thread emits its own signal; unrelated signals are expected to scale with thread count.
+    auto emitter = _new<Emitter>();
+    auto receiver = _new<Receiver>();
+    AObject::connect(emitter->test, slot(receiver)::receive);
+
+    for (auto _ : state) {
+        emitter->makeSignal();
+    }
+}
+BENCHMARK(SignalSlotMultithreaded)->ThreadRange(1, 8)->UseRealTime();
+
+static void SignalSlotConnectDisconnectMultithreaded(benchmark::State& state) {
+    auto emitter = _new<Emitter>();
+    auto receiver = _new<Receiver>();
+
+    for (auto _ : state) {
+        auto connection = AObject::connect(emitter->test, slot(receiver)::receive);
+        emitter->makeSignal();
+        connection->disconnect();
+    }
+}
+BENCHMARK(SignalSlotConnectDisconnectMultithreaded)->ThreadRange(1, 8)->UseRealTime();
+
+static void SignalSlotConnectTeardown(benchmark::State& state) {
+    // list-like object graph: many receivers connected to a single signal and destroyed all at once.
+    auto emitter = _new<Emitter>();
+    auto receivers = std::vector<_<Receiver>>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (auto& receiver : receivers) {
+            receiver = _new<Receiver>();
+        }
+        state.ResumeTiming();
+
+        for (auto& receiver : receivers) {
+            AObject::connect(emitter->test, slot(receiver)::receive);
+        }
+        for (auto& receiver : receivers) {
+            receiver = nullptr;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * receivers.size());
+}
+BENCHMARK(SignalSlotConnectTeardown)->Arg(4096);
@@ -1,6 +1,10 @@
 #include <benchmark/benchmark.h>
 #include "AUI/Common/AString.h"
+#include "AUI/Common/AByteBuffer.h"
+#include "AUI/Common/AStringBuilder.h"
+#include "AUI/Common/AStringVector.h"
 #include "AUI/Traits/macros.h"
+#include "AUI/Util/ATokenizer.h"
 
 
 static void StringUTF8(benchmark::State& state) {
@@ -10,4 +14,245 @@ static void StringUTF8(benchmark::State& state) {
     }
 }
 
-BENCHMARK(StringUTF8);
\ No newline at end of file
+BENCHMARK(StringUTF8);
+
+namespace {
+std::string makeText(bool ascii) {
+    std::string result;
+    while (result.size() < 4096) {
+        result += ascii ? "The quick brown fox jumps over the lazy dog. " : "Съешь же ещё этих мягких французских булок. ";
+    }
+    return result;
+}
+}
+
+static void StringFromUtf8Ascii(benchmark::State& state) {
+    auto text = makeText(true);
+    for (auto _ : state) {
+        AString s = text;
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(StringFromUtf8Ascii);
+
+static void StringFromUtf8Cyrillic(benchmark::State& state) {
+    auto text = makeText(false);
+    for (auto _ : state) {
+        AString s = text;
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size());
+}
+BENCHMARK(StringFromUtf8Cyrillic);
+
+static void StringToUtf8Ascii(benchmark::State& state) {
+    AString text = makeText(true);
+    for (auto _ : state) {
+        auto s = text.toStdString();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringToUtf8Ascii);
+
+static void StringToUtf8Cyrillic(benchmark::State& state) {
+    AString text = makeText(false);
+    for (auto _ : state) {
+        auto s = text.toUtf8();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringToUtf8Cyrillic);
+
+static void StringFindChar(benchmark::State& state) {
+    AString text = makeText(false);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.find(u'Ы'));
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringFindChar);
+
+static void StringFindSubstring(benchmark::State& state) {
+    AString text = makeText(true);
+    AString needle = "lazy cat";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.find(needle));
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringFindSubstring);
+
+static void StringReplacedAll(benchmark::State& state) {
+    AString text = makeText(true);
+    AString from = "fox";
+    AString to = "wolf";
+    for (auto _ : state) {
+        auto s = text.replacedAll(from, to);
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringReplacedAll);
+
+static void StringReplaceAllInPlace(benchmark::State& state) {
+    AString text = makeText(true);
+    for (auto _ : state) {
+        auto s = text;
+        s.replaceAll("fox", "wolf");
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringReplaceAllInPlace);
+
+static void StringSplit(benchmark::State& state) {
+    AString text = makeText(true);
+    for (auto _ : state) {
+        auto parts = text.split(' ');
+        benchmark::DoNotOptimize(parts);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringSplit);
+
+static void StringSplitView(benchmark::State& state) {
+    AString text = makeText(true);
+    for (auto _ : state) {
+        auto parts = text.splitView(' ');
+        benchmark::DoNotOptimize(parts);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringSplitView);
+
+static void StringUppercaseAscii(benchmark::State& state) {
+    AString text = makeText(true);
+    for (auto _ : state) {
+        auto s = text.uppercase();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringUppercaseAscii);
+
+static void StringLowercaseCyrillic(benchmark::State& state) {
+    AString text = AString(makeText(false)).uppercase();
+    for (auto _ : state) {
+        auto s = text.lowercase();
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetBytesProcessed(state.iterations() * text.size() * sizeof(char16_t));
+}
+BENCHMARK(StringLowercaseCyrillic);
+
+static void StringEqualsIgnoreCase(benchmark::State& state) {
+    AString lhs = makeText(false);
+    AString rhs = lhs.uppercase();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lhs.equalsIgnoreCase(rhs));
+    }
+    state.SetBytesProcessed(state.iterations() * lhs.size() * sizeof(char16_t));
+}
+BENCHMARK(StringEqualsIgnoreCase);
+
+static void StringNumberInt(benchmark::State& state) {
+    int i = 0;
+    for (auto _ : state) {
+        auto s = AString::number(i += 7919);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(StringNumberInt);
+
+static void StringNumberDouble(benchmark::State& state) {
+    double d = 0;
+    for (auto _ : state) {
+        auto s = AString::number(d += 1.25);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(StringNumberDouble);
+
+static void StringAppendNumber(benchmark::State& state) {
+    AString s;
+    for (auto _ : state) {
+        s.clear();
+        for (int i = 0; i < 100; ++i) {
+            s.appendNumber(i * 7919);
+            s << ',';
+        }
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(state.iterations() * 100);
+}
+BENCHMARK(StringAppendNumber);
+
+static void StringToInt(benchmark::State& state) {
+    AString text = "-1234567";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.toInt());
+    }
+}
+BENCHMARK(StringToInt);
+
+static void StringToDouble(benchmark::State& state) {
+    AString text = "-12345.6789";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.toDouble());
+    }
+}
+BENCHMARK(StringToDouble);
+
+static void StringTokenizerReadFloat(benchmark::State& state) {
+    std::string text;
+    for (int i = 0; i < 100; ++i) {
+        text += std::to_string(i * 31.25) + " ";
+    }
+    for (auto _ : state) {
+        ATokenizer t(text);
+        for (int i = 0; i < 100; ++i) {
+            benchmark::DoNotOptimize(t.readFloat());
+            t.readChar();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 100);
+}
+BENCHMARK(StringTokenizerReadFloat);
+
+static void StringConcatOperatorPlus(benchmark::State& state) {
+    AString token = "identifier";
+    int row = 123;
+    int column = 45;
+    for (auto _ : state) {
+        auto s = AString("unexpected token ") + token + " at " + AString::number(row) + ":" + AString::number(column);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(StringConcatOperatorPlus);
+
+static void StringConcatBuilder(benchmark::State& state) {
+    AString token = "identifier";
+    int row = 123;
+    int column = 45;
+    for (auto _ : state) {
+        auto s = AStringBuilder::concat("unexpected token ", token, " at ", row, ":", column);
+        benchmark::DoNotOptimize(s);
+    }
+}
+BENCHMARK(StringConcatBuilder);
+
+static void StringJoin(benchmark::State& state) {
+    AStringVector parts;
+    for (int i = 0; i < 1000; ++i) {
+        parts << "item" + AString::number(i);
+    }
+    for (auto _ : state) {
+        auto s = parts.join(", ");
+        benchmark::DoNotOptimize(s);
+    }
+    state.SetItemsProcessed(state.iterations() * parts.size());
+}
+BENCHMARK(StringJoin);
@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <AUI/Common/AObject.h>
+#include "AUI/Common/ASignal.h"
+#include "AUI/Util/kAUI.h"
+
+static constexpr auto TEST_VALUE = 228;
+
+namespace {
+thread_local std::size_t gAllocationCount = 0;
+thread_local std::size_t gAllocatedBytes = 0;
+}
+
+// counts heap allocations made by the current thread. Replaces global operator new for the AllocationBenchmarks
+// binary only.
+void* operator new(std::size_t size) {
+    ++gAllocationCount;
+    gAllocatedBytes += size;
+    if (auto p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+namespace {
+class Emitter: public AObject {
+public:
+    void makeSignal() {
+        emit test(TEST_VALUE);
+    }
+
+signals:
+    emits<int> test;
+};
+
+class Receiver: public AObject {
+public:
+    void receive(int v) {
+        benchmark::DoNotOptimize(v);
+    }
+};
+}
+
+static void SignalSlotEmitAllocations(benchmark::State& state) {
+    auto emitter = _new<Emitter>();
+    auto receiver = _new<Receiver>();
+    AObject::connect(emitter->test, slot(receiver)::receive);
+
+    auto allocationsBefore = gAllocationCount;
+    for (auto _ : state) {
+        emitter->makeSignal();
+    }
+    state.counters["allocs/emit"] =
+        benchmark::Counter(double(gAllocationCount - allocationsBefore), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(SignalSlotEmitAllocations);
+
+static void SignalSlotPropertyEmitAllocations(benchmark::State& state) {
+    // property-like emission: no sender object, several receivers on the same thread.
+    emits<int> signal;
+    auto receivers = std::vector<_<Receiver>>(3);
+    for (auto& receiver : receivers) {
+        receiver = _new<Receiver>();
+        AObject::connect(signal, slot(receiver)::receive);
+    }
+    // like views, which accept slot calls on their thread only.
+    receivers.front()->setSlotsCallsOnlyOnMyThread(true);
+
+    auto allocationsBefore = gAllocationCount;
+    for (auto _ : state) {
+        signal(TEST_VALUE).invokeSignal(nullptr);
+    }
+    state.counters["allocs/emit"] =
+        benchmark::Counter(double(gAllocationCount - allocationsBefore), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(SignalSlotPropertyEmitAllocations);
+
+static void SignalSlotConnectAllocations(benchmark::State& state) {
+    // list-like object graph: many receivers connected to a single signal and destroyed all at once.
+    auto emitter = _new<Emitter>();
+    auto receivers = std::vector<_<Receiver>>(state.range(0));
+    std::size_t connections = 0;
+    std::size_t allocations = 0;
+    std::size_t bytes = 0;
+    for (auto _ : state) {
+        for (auto& receiver : receivers) {
+            receiver = _new<Receiver>();
+        }
+
+        auto allocationsBefore = gAllocationCount;
+        auto bytesBefore = gAllocatedBytes;
+        for (auto& receiver : receivers) {
+            AObject::connect(emitter->test, slot(receiver)::receive);
+        }
+        allocations += gAllocationCount - allocationsBefore;
+        bytes += gAllocatedBytes - bytesBefore;
+        connections += receivers.size();
+
+        for (auto& receiver : receivers) {
+            receiver = nullptr;
+        }
+    }
+    state.counters["allocs/connection"] = double(allocations) / double(connections);
+    state.counters["bytes/connection"] = double(bytes) / double(connections);
+}
+BENCHMARK(SignalSlotConnectAllocations)->Arg(4096);
@@ -10,27 +10,249 @@
  */
 
 #include <range/v3/algorithm/find.hpp>
+#include <algorithm>
+#include <vector>
 
 #include "AAbstractSignal.h"
 #include "AObject.h"
 
-void AAbstractSignal::addIngoingConnectionIn(aui::no_escape<AObjectBase> object, _<Connection> connection) {
-    std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
-    object->mIngoingConnections.emplace_back(std::move(connection));
+ASpinlockMutex& aui::detail::signal::SyncStripes::of(const void* address) noexcept {
+    struct alignas(64) Stripe {
+        ASpinlockMutex mutex;
+    };
+    static Stripe stripes[COUNT];
+
+    // fibonacci hashing; low bits are dropped as they are the same for aligned objects.
+    auto hash = (std::uint64_t(reinterpret_cast<std::uintptr_t>(address)) >> 4) * 0x9E3779B97F4A7C15ull;
+    return stripes[hash >> (64 - 8)].mutex;
+}
+static_assert(aui::detail::signal::SyncStripes::COUNT == 1 << 8);
+
+namespace {
+using ConnectionPool = aui::detail::signal::ConnectionPool;
+
+constexpr std::size_t SIZE_CLASS_COUNT = ConnectionPool::MAX_BLOCK_SIZE / ConnectionPool::GRANULARITY;
+constexpr std::size_t SLAB_SIZE = 64 * 1024;
+
+/**
+ * @brief Count of free blocks of a size class a thread keeps before spilling half of them to the shared list.
+ */
+constexpr std::size_t THREAD_CACHE_LIMIT = 512;
+
+/**
+ * @brief Count of free blocks a thread takes from the shared list at once.
+ */
+constexpr std::size_t REFILL_BATCH = 64;
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+struct FreeList {
+    FreeBlock* head = nullptr;
+    std::size_t count = 0;
+
+    void push(void* block) noexcept {
+        auto b = static_cast<FreeBlock*>(block);
+        b->next = head;
+        head = b;
+        ++count;
+    }
+
+    void* pop() noexcept {
+        auto b = head;
+        head = b->next;
+        --count;
+        return b;
+    }
+
+    void moveTo(FreeList& destination, std::size_t n) noexcept {
+        for (; n > 0 && head; --n) {
+            destination.push(pop());
+        }
+    }
+};
+
+struct SharedFreeLists {
+    struct alignas(64) Entry {
+        ASpinlockMutex sync;
+        FreeList list;
+
+        /**
+         * @brief Slabs carved for this size class; used by ConnectionPool::trim.
+         */
+        std::vector<std::byte*> slabs;
+    };
+    Entry entries[SIZE_CLASS_COUNT];
+};
+
+SharedFreeLists& sharedFreeLists() noexcept {
+    // never destroyed: connections may be released during static destruction.
+    static auto lists = new SharedFreeLists;
+    return *lists;
 }
 
-void AAbstractSignal::removeIngoingConnectionIn(aui::no_escape<AObjectBase> object, Connection& connection, std::unique_lock<ASpinlockMutex>& lock) {
-    auto c = [&]() -> _<Connection> {
-        auto it = ranges::find(object->mIngoingConnections, &connection, [](const auto& v) { return v.value.get(); });
-        if (it == object->mIngoingConnections.end()) {
-            return nullptr;
+thread_local bool gThreadCacheDestroyed = false;
+
+struct ThreadCache {
+    FreeList lists[SIZE_CLASS_COUNT];
+
+    ~ThreadCache() {
+        for (std::size_t i = 0; i < SIZE_CLASS_COUNT; ++i) {
+            if (lists[i].count == 0) {
+                continue;
+            }
+            auto& shared = sharedFreeLists().entries[i];
+            std::unique_lock lock(shared.sync);
+            lists[i].moveTo(shared.list, lists[i].count);
         }
-        auto value = std::exchange(it->value, nullptr);
-        object->mIngoingConnections.erase(it);
-        lock.unlock();
-        return value;
-    }();
-    c.reset();
+        gThreadCacheDestroyed = true;
+    }
+};
+
+thread_local ThreadCache gThreadCache;
+
+ThreadCache* threadCache() noexcept {
+    if (gThreadCacheDestroyed) [[unlikely]] {
+        // the thread is exiting.
+        return nullptr;
+    }
+    return &gThreadCache;
 }
 
-_weak<AObject> AAbstractSignal::weakPtrFromObject(AObject* object) { return object->weakPtr(); }
+/**
+ * @brief Puts free blocks of the size class to the list, taking them from the shared list or carving a new slab.
+ */
+void refill(FreeList& list, std::size_t sizeClass) {
+    {
+        auto& shared = sharedFreeLists().entries[sizeClass];
+        std::unique_lock lock(shared.sync);
+        shared.list.moveTo(list, REFILL_BATCH);
+    }
+    if (list.count > 0) {
+        return;
+    }
+    auto blockSize = (sizeClass + 1) * ConnectionPool::GRANULARITY;
+    auto slab = static_cast<std::byte*>(::operator new(SLAB_SIZE));
+    try {
+        auto& shared = sharedFreeLists().entries[sizeClass];
+        std::unique_lock lock(shared.sync);
+        shared.slabs.push_back(slab);
+    } catch (...) {
+        ::operator delete(slab);
+        throw;
+    }
+    for (std::size_t offset = 0; offset + blockSize <= SLAB_SIZE; offset += blockSize) {
+        list.push(slab + offset);
+    }
+}
+}
+
+void* aui::detail::signal::ConnectionPool::allocate(std::size_t size) {
+    if (size > MAX_BLOCK_SIZE || size == 0) [[unlikely]] {
+        return ::operator new(size);
+    }
+    auto sizeClass = (size - 1) / GRANULARITY;
+    auto cache = threadCache();
+    if (!cache) [[unlikely]] {
+        FreeList list;
+        refill(list, sizeClass);
+        auto block = list.pop();
+        auto& shared = sharedFreeLists().entries[sizeClass];
+        std::unique_lock lock(shared.sync);
+        list.moveTo(shared.list, list.count);
+        return block;
+    }
+    auto& list = cache->lists[sizeClass];
+    if (list.count == 0) {
+        refill(list, sizeClass);
+    }
+    return list.pop();
+}
+
+void aui::detail::signal::ConnectionPool::deallocate(void* block, std::size_t size) noexcept {
+    if (size > MAX_BLOCK_SIZE || size == 0) [[unlikely]] {
+        ::operator delete(block);
+        return;
+    }
+    auto sizeClass = (size - 1) / GRANULARITY;
+    auto& shared = sharedFreeLists().entries[sizeClass];
+    auto cache = threadCache();
+    if (!cache) [[unlikely]] {
+        std::unique_lock lock(shared.sync);
+        shared.list.push(block);
+        return;
+    }
+    auto& list = cache->lists[sizeClass];
+    list.push(block);
+    if (list.count > THREAD_CACHE_LIMIT) {
+        std::unique_lock lock(shared.sync);
+        list.moveTo(shared.list, THREAD_CACHE_LIMIT / 2);
+    }
+}
+
+std::size_t aui::detail::signal::ConnectionPool::trim() {
+    std::size_t result = 0;
+    auto cache = threadCache();
+    for (std::size_t sizeClass = 0; sizeClass < SIZE_CLASS_COUNT; ++sizeClass) {
+        auto& shared = sharedFreeLists().entries[sizeClass];
+        std::unique_lock lock(shared.sync);
+        if (cache) {
+            auto& list = cache->lists[sizeClass];
+            list.moveTo(shared.list, list.count);
+        }
+        if (shared.slabs.empty()) {
+            continue;
+        }
+
+        auto& slabs = shared.slabs;
+        std::sort(slabs.begin(), slabs.end(), std::less<>{});
+        auto slabOf = [&](void* block) {
+            auto it = std::upper_bound(slabs.begin(), slabs.end(), static_cast<std::byte*>(block), std::less<>{});
+            return std::size_t(it - slabs.begin()) - 1;
+        };
+
+        // a slab is unused if all of its blocks are in the shared list.
+        std::vector<std::size_t> freeBlocks(slabs.size(), 0);
+        for (auto block = shared.list.head; block; block = block->next) {
+            ++freeBlocks[slabOf(block)];
+        }
+        const auto blocksPerSlab = SLAB_SIZE / ((sizeClass + 1) * GRANULARITY);
+        auto isUnused = [&](std::size_t slabIndex) { return freeBlocks[slabIndex] == blocksPerSlab; };
+
+        FreeList kept;
+        while (shared.list.head) {
+            auto block = shared.list.pop();
+            if (!isUnused(slabOf(block))) {
+                kept.push(block);
+            }
+        }
+        shared.list = kept;
+
+        std::size_t keptSlabs = 0;
+        for (std::size_t i = 0; i < slabs.size(); ++i) {
+            if (isUnused(i)) {
+                ::operator delete(slabs[i]);
+                result += SLAB_SIZE;
+            } else {
+                slabs[keptSlabs++] = slabs[i];
+            }
+        }
+        slabs.resize(keptSlabs);
+    }
+    return result;
+}
+
+void AAbstractSignal::addIngoingConnectionIn(aui::no_escape<AObjectBase> object, _<Connection> connection) {
+    object->mIngoingConnections.emplace_back(std::move(connection));
+}
+
+_<AAbstractSignal::Connection> AAbstractSignal::removeIngoingConnectionIn(aui::no_escape<AObjectBase> object, Connection& connection) {
+    auto it = ranges::find(object->mIngoingConnections, &connection, [](const auto& v) { return v.value.get(); });
+    if (it == object->mIngoingConnections.end()) {
+        return nullptr;
+    }
+    auto value = std::exchange(it->value, nullptr);
+    object->mIngoingConnections.erase(it);
+    return value;
+}
@@ -12,13 +12,165 @@
 #pragma once
 
 #include <exception>
+#include <memory>
 
 #include <AUI/Core.h>
 #include <AUI/Common/SharedPtrTypes.h>
+#include <AUI/Thread/AMutex.h>
 #include <AUI/Traits/values.h>
 
 class AObject;
 
+namespace aui::detail::signal {
+/**
+ * @brief Striped locks of the signal-slot system.
+ * @details
+ * Outgoing connections of a signal are guarded by the stripe of the signal's address; ingoing connections of an object
+ * are guarded by the stripe of the object's address. Connection fields shared by both sides are modified with both
+ * stripes locked (see PairGuard), so holding either one is enough to read them.
+ *
+ * Unrelated signals and objects most likely map to different stripes, so emitting signals on different threads does
+ * not contend on a single process-wide lock.
+ */
+class API_AUI_CORE SyncStripes {
+public:
+    static constexpr std::size_t COUNT = 256;
+
+    /**
+     * @return stripe guarding the signal or object located at address.
+     */
+    static ASpinlockMutex& of(const void* address) noexcept;
+
+    /**
+     * @brief Locks two stripes in a deadlock-free order.
+     * @details
+     * Stripes are always locked in the order of their addresses. If both arguments refer to the same stripe, it is
+     * locked once.
+     */
+    class PairGuard {
+    public:
+        PairGuard(ASpinlockMutex& a, ASpinlockMutex& b) noexcept
+          : mFirst(&a < &b ? &a : &b), mSecond(&a == &b ? nullptr : (&a < &b ? &b : &a)) {
+            mFirst->lock();
+            if (mSecond) {
+                mSecond->lock();
+            }
+        }
+        PairGuard(const PairGuard&) = delete;
+        PairGuard& operator=(const PairGuard&) = delete;
+
+        ~PairGuard() {
+            if (mSecond) {
+                mSecond->unlock();
+            }
+            mFirst->unlock();
+        }
+
+    private:
+        ASpinlockMutex* mFirst;
+        ASpinlockMutex* mSecond;
+    };
+};
+
+/**
+ * @brief Slab allocator of connection objects.
+ * @details
+ * Connections are small, may be created in large numbers (i.e., by a list with many rows) and are often destroyed all
+ * at once when an object dies. Allocating them one by one from the general purpose heap fragments it and makes such
+ * teardown slow.
+ *
+ * ConnectionPool hands out blocks of a few fixed sizes carved from 64 KiB slabs. Freed blocks are kept in per-thread
+ * free lists which spill to a shared free list in batches, so creating and destroying connections does not touch the
+ * heap in steady state. Slabs are returned to the system by trim() only.
+ */
+class API_AUI_CORE ConnectionPool {
+public:
+    static constexpr std::size_t GRANULARITY = 16;
+    static constexpr std::size_t MAX_BLOCK_SIZE = 512;
+
+    /**
+     * @brief Allocates a block of at least size bytes aligned to GRANULARITY.
+     * @details
+     * Blocks larger than MAX_BLOCK_SIZE are allocated with operator new.
+     */
+    static void* allocate(std::size_t size);
+
+    /**
+     * @brief Returns the block allocated with allocate(size).
+     */
+    static void deallocate(void* block, std::size_t size) noexcept;
+
+    /**
+     * @brief Returns slabs whose blocks are all free to the system.
+     * @return count of bytes returned.
+     * @details
+     * Blocks cached by the calling thread are considered; blocks cached by other threads are not, so their slabs are
+     * kept. Intended to be called after a large object graph is torn down (i.e., a window with a long list is closed).
+     */
+    static std::size_t trim();
+
+    /**
+     * @brief Allocator adapter of ConnectionPool for std::allocate_shared.
+     */
+    template <typename T>
+    struct Allocator {
+        using value_type = T;
+
+        Allocator() noexcept = default;
+
+        template <typename U>
+        Allocator(const Allocator<U>&) noexcept {}
+
+        T* allocate(std::size_t n) {
+            if constexpr (alignof(T) > GRANULARITY) {
+                return std::allocator<T>().allocate(n);
+            } else {
+                return static_cast<T*>(ConnectionPool::allocate(n * sizeof(T)));
+            }
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept {
+            if constexpr (alignof(T) > GRANULARITY) {
+                std::allocator<T>().deallocate(p, n);
+            } else {
+                ConnectionPool::deallocate(p, n * sizeof(T));
+            }
+        }
+
+        template <typename U>
+        bool operator==(const Allocator<U>&) const noexcept {
+            return true;
+        }
+    };
+};
+}   // namespace aui::detail::signal
+
+namespace aui {
+/**
+ * @brief Tag type of aui::coalesce.
+ */
+struct coalesce_t {
+    explicit coalesce_t() = default;
+};
+
+/**
+ * @brief Connection policy that coalesces cross-thread slot calls.
+ * @ingroup signal_slot
+ * @details
+ * Normally, every emission of a signal whose receiver lives on another thread queues a separate slot call (with a copy
+ * of the arguments) to the receiver's thread. With aui::coalesce, at most one slot call per connection is pending;
+ * emissions made before it runs replace its arguments with the latest ones. Hence, the receiver's queue does not grow
+ * with emission rate, which is desired for progress-like signals where only the latest value matters.
+ *
+ * Slot calls on the emitting thread are not affected.
+ *
+ * @code{cpp}
+ * connect(worker->progress, slot(progressBar)::setValue, aui::coalesce);
+ * @endcode
+ */
+inline constexpr coalesce_t coalesce{};
+}   // namespace aui
+
 /**
  * @defgroup signal_slot Signal-slot
  * @ingroup core
@@ -388,6 +540,19 @@ public:
          * This cleanup function assumes that an appropriate clean action for the receiver side is taken.
          */
         virtual void onBeforeReceiverSideDestroyed() = 0;
+
+        /**
+         * @brief Same as onBeforeReceiverSideDestroyed, but both stripes are locked by the caller.
+         * @details
+         * The caller must hold a reference to the connection, so it is not destroyed under the locks.
+         */
+        virtual void onBeforeReceiverSideDestroyedLocked() noexcept = 0;
+
+        /**
+         * @return stripe of the sender signal.
+         */
+        [[nodiscard]]
+        virtual ASpinlockMutex& senderStripe() const noexcept = 0;
     };
 
     /**
@@ -458,15 +623,19 @@ public:
 protected:
     /* some handy functions accessed from public headers */
 
-    static _weak<AObject> weakPtrFromObject(AObject* object);
-
     /**
      * @brief Adds a connection to the specified object.
+     * @details
+     * The object's stripe must be locked by the caller.
      */
     static void addIngoingConnectionIn(aui::no_escape<AObjectBase> object, _<Connection> connection);
 
     /**
      * @brief Removes a connection from the specified object.
+     * @details
+     * The object's stripe must be locked by the caller.
+     * @return ownership of the removed connection, if any. It must be released after unlocking the stripe.
      */
-    static void removeIngoingConnectionIn(aui::no_escape<AObjectBase> object, Connection& connection, std::unique_lock<ASpinlockMutex>& lock);
+    [[nodiscard]]
+    static _<Connection> removeIngoingConnectionIn(aui::no_escape<AObjectBase> object, Connection& connection);
 };
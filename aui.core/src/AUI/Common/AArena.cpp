@@ -0,0 +1,82 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <algorithm>
+#include "AArena.h"
+
+AArena::AArena(std::size_t initialChunkSize, std::pmr::memory_resource* upstream) noexcept:
+    mUpstream(upstream),
+    mInitialChunkSize(std::max(initialChunkSize, sizeof(Chunk) * 2)),
+    mNextChunkSize(mInitialChunkSize) {}
+
+AArena::~AArena() {
+    release();
+}
+
+void* AArena::allocateChunk(std::size_t bytes, std::size_t alignment) {
+    auto size = std::max(mNextChunkSize, sizeof(Chunk) + bytes + alignment);
+    auto chunk = static_cast<Chunk*>(mUpstream->allocate(size, alignof(std::max_align_t)));
+    chunk->size = size;
+    chunk->next = mChunks;
+    mChunks = chunk;
+    mNextChunkSize = size * 2;
+    useChunk(chunk);
+    return do_allocate(bytes, alignment);
+}
+
+void AArena::useChunk(Chunk* chunk) noexcept {
+    mCurrent = reinterpret_cast<std::uintptr_t>(chunk + 1);
+    mEnd = reinterpret_cast<std::uintptr_t>(chunk) + chunk->size;
+}
+
+void AArena::reset() noexcept {
+    Chunk* largest = nullptr;
+    for (auto chunk = mChunks; chunk != nullptr;) {
+        auto next = chunk->next;
+        if (largest == nullptr || chunk->size > largest->size) {
+            if (largest != nullptr) {
+                mUpstream->deallocate(largest, largest->size, alignof(std::max_align_t));
+            }
+            largest = chunk;
+        } else {
+            mUpstream->deallocate(chunk, chunk->size, alignof(std::max_align_t));
+        }
+        chunk = next;
+    }
+    mChunks = largest;
+    mBytesAllocated = 0;
+    if (largest == nullptr) {
+        mCurrent = mEnd = 0;
+        return;
+    }
+    largest->next = nullptr;
+    useChunk(largest);
+}
+
+void AArena::release() noexcept {
+    for (auto chunk = mChunks; chunk != nullptr;) {
+        auto next = chunk->next;
+        mUpstream->deallocate(chunk, chunk->size, alignof(std::max_align_t));
+        chunk = next;
+    }
+    mChunks = nullptr;
+    mCurrent = mEnd = 0;
+    mNextChunkSize = mInitialChunkSize;
+    mBytesAllocated = 0;
+}
+
+std::size_t AArena::bytesReserved() const noexcept {
+    std::size_t result = 0;
+    for (auto chunk = mChunks; chunk != nullptr; chunk = chunk->next) {
+        result += chunk->size;
+    }
+    return result;
+}
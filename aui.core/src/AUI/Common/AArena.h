@@ -0,0 +1,146 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include "AUI/Core.h"
+#include "AUI/Common/AVector.h"
+
+/**
+ * @brief Monotonic memory resource: allocates by bumping a pointer and frees everything at once.
+ * @ingroup core
+ * @details
+ * Parsing a document or computing frame temporaries allocates thousands of small objects that die together. AArena
+ * hands out memory from large chunks, ignores individual deallocations and gives everything back on reset(), which
+ * costs the same for one object and for a million of them.
+ *
+ * AArena is a std::pmr::memory_resource, so it serves any container with std::pmr::polymorphic_allocator:
+ * aui::pmr::AVector, std::pmr containers, AByteBuffer and AJson::fromBuffer accept it:
+ *
+ * @code{cpp}
+ * AArena arena;
+ * for (const auto& file : files) {
+ *     {
+ *         auto json = AJson::fromBuffer(AByteBuffer::fromStream(AFileInputStream(file)), &arena);
+ *         process(json);
+ *     } // json must die before the arena is reset
+ *     arena.reset();
+ * }
+ * @endcode
+ *
+ * Objects allocated from the arena must be destroyed before reset(), release() or the arena destructor. Copies of
+ * pmr containers are allocated from the default resource, so copy the values that must outlive the arena.
+ *
+ * AArena is not thread safe.
+ */
+class API_AUI_CORE AArena final: public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+    /**
+     * @param initialChunkSize size of the first chunk requested from upstream; each next chunk is twice as large.
+     * @param upstream resource the chunks are allocated from.
+     */
+    explicit AArena(std::size_t initialChunkSize = DEFAULT_CHUNK_SIZE,
+                    std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+
+    AArena(const AArena&) = delete;
+    AArena& operator=(const AArena&) = delete;
+
+    ~AArena() override;
+
+    /**
+     * @brief Frees all allocations at once, keeping the largest chunk for the next ones.
+     * @details
+     * A cycle of allocations followed by reset() stops requesting memory from upstream once the kept chunk fits the
+     * whole cycle.
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Frees all allocations at once and returns all chunks to upstream.
+     */
+    void release() noexcept;
+
+    /**
+     * @return count of bytes allocated since the last reset.
+     */
+    [[nodiscard]]
+    std::size_t bytesAllocated() const noexcept {
+        return mBytesAllocated;
+    }
+
+    /**
+     * @return count of bytes held in chunks, including the unused ones.
+     */
+    [[nodiscard]]
+    std::size_t bytesReserved() const noexcept;
+
+    [[nodiscard]]
+    std::pmr::memory_resource* upstream() const noexcept {
+        return mUpstream;
+    }
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        auto aligned = (mCurrent + alignment - 1) & ~std::uintptr_t(alignment - 1);
+        // >= also sends zero-byte allocations to a chunk while there is none.
+        if (aligned > mEnd || bytes >= mEnd - aligned) {
+            return allocateChunk(bytes, alignment);
+        }
+        mCurrent = aligned + bytes;
+        mBytesAllocated += bytes;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) noexcept override {
+        // freed all at once by reset
+    }
+
+    [[nodiscard]]
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    struct Chunk {
+        Chunk* next;
+        std::size_t size;
+    };
+
+    std::pmr::memory_resource* mUpstream;
+
+    /**
+     * Most recently allocated chunk first.
+     */
+    Chunk* mChunks = nullptr;
+
+    std::uintptr_t mCurrent = 0;
+    std::uintptr_t mEnd = 0;
+    std::size_t mInitialChunkSize;
+    std::size_t mNextChunkSize;
+    std::size_t mBytesAllocated = 0;
+
+    void* allocateChunk(std::size_t bytes, std::size_t alignment);
+    void useChunk(Chunk* chunk) noexcept;
+};
+
+namespace aui::pmr {
+    /**
+     * @brief AVector allocating from a std::pmr::memory_resource, i.e., AArena.
+     * @ingroup core
+     */
+    template<typename T>
+    using AVector = ::AVector<T, std::pmr::polymorphic_allocator<T>>;
+}
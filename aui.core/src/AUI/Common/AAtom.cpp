@@ -0,0 +1,103 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include "AAtom.h"
+
+namespace {
+    struct Key {
+        std::u16string_view string;
+        std::size_t hash;
+
+        bool operator==(const Key& rhs) const noexcept {
+            return string == rhs.string;
+        }
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const noexcept {
+            return key.hash;
+        }
+    };
+
+    struct alignas(64) Shard {
+        std::shared_mutex mutex;
+        std::unordered_map<Key, const AAtom::Entry*, KeyHash> entries;
+    };
+
+    constexpr std::size_t SHARD_BITS = 4;
+
+    Shard& shardOf(std::size_t hash) noexcept {
+        // leaked intentionally: atoms may be used by destructors of other static objects.
+        static auto shards = new Shard[1 << SHARD_BITS];
+        return shards[hash >> (sizeof(hash) * 8 - SHARD_BITS)];
+    }
+
+    const AAtom::Entry& emptyEntry() noexcept {
+        static const AAtom::Entry entry{ {}, std::hash<std::u16string_view>{}({}) };
+        return entry;
+    }
+
+    Key keyOf(const AString& string) noexcept {
+        Key key{ { string.data(), string.size() }, 0 };
+        key.hash = std::hash<std::u16string_view>{}(key.string);
+        return key;
+    }
+
+    const AAtom::Entry* findEntry(Shard& shard, const Key& key) {
+        std::shared_lock lock(shard.mutex);
+        if (auto it = shard.entries.find(key); it != shard.entries.end()) {
+            return it->second;
+        }
+        return nullptr;
+    }
+}
+
+AAtom::AAtom() noexcept: mEntry(&emptyEntry()) {}
+
+AAtom::AAtom(const AString& string) {
+    if (string.empty()) {
+        mEntry = &emptyEntry();
+        return;
+    }
+    auto key = keyOf(string);
+    auto& shard = shardOf(key.hash);
+    if (auto entry = findEntry(shard, key)) {
+        mEntry = entry;
+        return;
+    }
+
+    std::unique_lock lock(shard.mutex);
+    if (auto it = shard.entries.find(key); it != shard.entries.end()) {
+        // interned by another thread in the meantime.
+        mEntry = it->second;
+        return;
+    }
+    auto entry = new Entry{ string, key.hash };
+    // the key must refer to the interned copy.
+    key.string = { entry->string.data(), entry->string.size() };
+    shard.entries.emplace(key, entry);
+    mEntry = entry;
+}
+
+AOptional<AAtom> AAtom::find(const AString& string) {
+    if (string.empty()) {
+        return AAtom();
+    }
+    auto key = keyOf(string);
+    if (auto entry = findEntry(shardOf(key.hash), key)) {
+        return AAtom(entry);
+    }
+    return std::nullopt;
+}
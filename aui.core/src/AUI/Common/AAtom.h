@@ -0,0 +1,128 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include "AUI/Common/AOptional.h"
+#include "AUI/Common/AString.h"
+
+/**
+ * @brief Interned immutable string.
+ * @ingroup core
+ * @details
+ * AAtom refers to the only copy of the string in the process-wide intern table. Atoms created from equal strings refer
+ * to the same entry, so comparing two atoms is a pointer comparison, and the hash is computed once, on interning.
+ *
+ * Creating an atom hashes the string and looks it up in the table, which is sharded and guarded by shared locks, so
+ * concurrent lookups of existing atoms do not block each other. Create atoms once (as static variables or data
+ * members) and compare them many times:
+ *
+ * @code{cpp}
+ * static const AAtom OVERRIDE_TITLE_DRAGGING(".override-title-dragging");
+ * if (view->getAssNames().contains(OVERRIDE_TITLE_DRAGGING)) { // pointer comparisons
+ *     ...
+ * }
+ * @endcode
+ *
+ * Interned strings are never freed. Do not intern unbounded sets of strings, i.e., user input or document contents.
+ */
+class API_AUI_CORE AAtom {
+public:
+    /**
+     * @brief Empty string atom.
+     */
+    AAtom() noexcept;
+
+    /*
+     * Not implicit, so lookups by strings (i.e., AAtomVector::contains) don't intern them, and functions overloaded for
+     * both AString and AAtom can be called with string literals.
+     */
+    explicit AAtom(const AString& string);
+
+    explicit AAtom(const char* utf8): AAtom(AString(utf8)) {}
+
+    explicit AAtom(const char16_t* string): AAtom(AString(string)) {}
+
+    /**
+     * @brief Atom of the string if it is interned already.
+     * @details
+     * Unlike the constructor, never adds the string to the intern table. Use it to look up strings of unbounded sets
+     * (i.e., to remove a name from a collection of atoms).
+     */
+    [[nodiscard]]
+    static AOptional<AAtom> find(const AString& string);
+
+    [[nodiscard]]
+    const AString& str() const noexcept {
+        return mEntry->string;
+    }
+
+    operator const AString&() const noexcept {
+        return mEntry->string;
+    }
+
+    /**
+     * @return hash of the string, equal to std::hash<AString> of it.
+     */
+    [[nodiscard]]
+    std::size_t hash() const noexcept {
+        return mEntry->hash;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return mEntry->string.empty();
+    }
+
+    [[nodiscard]]
+    bool operator==(const AAtom& rhs) const noexcept {
+        return mEntry == rhs.mEntry;
+    }
+
+    [[nodiscard]]
+    bool operator==(const AString& rhs) const noexcept {
+        return mEntry->string == rhs;
+    }
+
+    [[nodiscard]]
+    bool operator==(const char* rhs) const noexcept {
+        return mEntry->string == rhs;
+    }
+
+    struct Entry {
+        AString string;
+        std::size_t hash;
+    };
+
+private:
+    const Entry* mEntry;
+
+    explicit AAtom(const Entry* entry) noexcept: mEntry(entry) {}
+};
+
+template<>
+struct std::hash<AAtom> {
+    std::size_t operator()(const AAtom& atom) const noexcept {
+        return atom.hash();
+    }
+};
+
+template <> struct fmt::formatter<AAtom>: fmt::formatter<AString> {
+    auto format(const AAtom& atom, format_context& ctx) const {
+        return fmt::formatter<AString>::format(atom.str(), ctx);
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& o, const AAtom& atom) {
+    return o << atom.str();
+}
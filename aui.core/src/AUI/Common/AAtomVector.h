@@ -0,0 +1,37 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+#include "AAtom.h"
+#include "AVector.h"
+
+
+/**
+ * @brief An AVector of atoms which can be looked up by strings.
+ * @ingroup core
+ * @details
+ * Strings are looked up with AAtom::find, so a lookup never adds the string to the intern table.
+ */
+class AAtomVector: public AVector<AAtom>
+{
+public:
+    using AVector<AAtom>::AVector;
+    using AVector<AAtom>::contains;
+
+    /**
+     * @return true if the vector contains the atom of the string, false otherwise.
+     */
+    [[nodiscard]]
+    bool contains(const AString& string) const {
+        auto atom = AAtom::find(string);
+        return atom && contains(*atom);
+    }
+};
@@ -43,10 +43,10 @@ AByteBuffer::AByteBuffer(AByteBuffer&& other) noexcept
 }
 
 void AByteBuffer::reserve(size_t size) {
-    char* buffer = new char[size];
+    char* buffer = allocate(size);
     if (mBuffer) {
         memcpy(buffer, mBuffer, glm::min(mCapacity, size));
-        delete[] mBuffer;
+        deallocate();
     }
     mCapacity = size;
     mBuffer = buffer;
@@ -123,7 +123,7 @@ std::ostream& operator<<(std::ostream& o, AByteBufferView buffer)
 }
 
 AByteBuffer::~AByteBuffer() {
-    delete[] mBuffer;
+    deallocate();
     mBuffer = nullptr;
 }
 
@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstring>
+#include <memory_resource>
 #include <string>
 #include <stdexcept>
 #include <cassert>
@@ -33,6 +34,18 @@ private:
     char* mBuffer = nullptr;
     size_t mCapacity = 0;
     size_t mSize = 0;
+    std::pmr::memory_resource* mResource = std::pmr::get_default_resource();
+
+    char* allocate(size_t size) {
+        // aligned as new char[] is, data may be accessed as any type with at<T>.
+        return static_cast<char*>(mResource->allocate(size, alignof(std::max_align_t)));
+    }
+
+    void deallocate() noexcept {
+        if (mBuffer) {
+            mResource->deallocate(mBuffer, mCapacity, alignof(std::max_align_t));
+        }
+    }
 
 public:
     using iterator = char*;
@@ -41,6 +54,13 @@ public:
     AByteBuffer(const char* buffer, size_t size);
     explicit AByteBuffer(size_t initialCapacity);
     AByteBuffer(const unsigned char* buffer, size_t size);
+
+    /**
+     * @brief Creates an empty buffer allocating from the specified memory resource, i.e., AArena.
+     * @details
+     * Moving the buffer moves the resource along with the data; copies allocate from the default resource.
+     */
+    explicit AByteBuffer(std::pmr::memory_resource* resource) noexcept: mResource(resource) {}
     AByteBuffer(AByteBufferView other) {
         reserve(other.size());
         memcpy(mBuffer, other.data(), other.size());
@@ -77,7 +97,7 @@ public:
     }
 
     void clear() {
-        delete[] mBuffer;
+        deallocate();
         mBuffer = nullptr;
         mSize = mCapacity = 0;
     }
@@ -196,11 +216,11 @@ public:
      */
     void reallocate(size_t s) {
         if (mCapacity != s) {
-            delete[] mBuffer;
+            deallocate();
             if (s == 0) {
                 mBuffer = nullptr;
             } else {
-                mBuffer = new char[s];
+                mBuffer = allocate(s);
             }
             mCapacity = s;
         }
@@ -242,15 +262,23 @@ public:
         return mCapacity;
     }
 
+    /**
+     * @return memory resource the buffer is allocated from.
+     */
+    std::pmr::memory_resource* resource() const noexcept {
+        return mResource;
+    }
+
     AByteBuffer& operator=(AByteBuffer&& other) noexcept {
         if (&other == this) {
             return *this;
         }
 
-        delete[] mBuffer;
+        deallocate();
         mBuffer = other.mBuffer;
         mCapacity = other.mCapacity;
         mSize = other.mSize;
+        mResource = other.mResource;
 
         other.mBuffer = nullptr;
         other.mCapacity = 0;
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <functional>
 #include <vector>
 #include <map>
 
@@ -20,5 +21,14 @@ class AMap;
 template <class KeyType, class ValueType, class Hasher = std::hash<KeyType>, class Comparer = std::equal_to<KeyType>, class Allocator = std::allocator<std::pair<const KeyType, ValueType>>>
 class AUnorderedMap;
 
+template <class KeyType, class ValueType, class Hasher = std::hash<KeyType>, class Comparer = std::equal_to<KeyType>>
+class AFlatHashMap;
+
+template <class KeyType, class Hasher = std::hash<KeyType>, class Comparer = std::equal_to<KeyType>>
+class AFlatHashSet;
+
+template <class KeyType, class ValueType, class Predicate = std::less<KeyType>, class Allocator = std::allocator<std::pair<const KeyType, ValueType>>>
+class AFlatMap;
+
 template <class StoredType, class Allocator = std::allocator<StoredType>>
 class AVector;
\ No newline at end of file
@@ -0,0 +1,37 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "AMap.h"
+#include "AContainerPrototypes.h"
+#include "detail/flat_hash.h"
+
+/**
+ * @brief A hash map storing elements in a flat open addressing table, with AUI extensions.
+ * @ingroup core
+ * @details
+ * Unlike AUnorderedMap, AFlatHashMap does not allocate a node per element: all elements live in a single array, and
+ * a lookup usually costs one 16-byte SIMD comparison of the control bytes and one key comparison. Prefer it for maps
+ * that are looked up much more often than they are modified.
+ *
+ * Differences from AUnorderedMap:
+ * - inserting may move elements, so it invalidates all iterators, pointers and references to elements. Store
+ *   _unique<T> values if references must outlive insertions;
+ * - iteration order is unspecified.
+ */
+template <class KeyType, class ValueType, class Hasher, class Comparer>
+class AFlatHashMap: public ABaseMap<KeyType, ValueType, aui::detail::flat_hash::Map<KeyType, ValueType, Hasher, Comparer>>
+{
+	using parent = ABaseMap<KeyType, ValueType, aui::detail::flat_hash::Map<KeyType, ValueType, Hasher, Comparer>>;
+
+	using parent::parent;
+};
@@ -0,0 +1,104 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <AUI/Traits/containers.h>
+#include "AContainerPrototypes.h"
+#include "detail/flat_hash.h"
+
+/**
+ * @brief A hash set storing elements in a flat open addressing table, with AUI extensions.
+ * @ingroup core
+ * @details
+ * See AFlatHashMap. Inserting invalidates all iterators, pointers and references to elements; iteration order is
+ * unspecified.
+ */
+template <class KeyType, class Hasher, class Comparer>
+class AFlatHashSet: public aui::detail::flat_hash::Table<KeyType, KeyType, aui::detail::flat_hash::SetKey, Hasher, Comparer>
+{
+private:
+    using p = aui::detail::flat_hash::Table<KeyType, KeyType, aui::detail::flat_hash::SetKey, Hasher, Comparer>;
+    using self = AFlatHashSet<KeyType, Hasher, Comparer>;
+
+public:
+    using p::p;
+
+    /**
+     * Inserts all values of the specified container.
+     * @tparam OtherContainer other container type.
+     * @param c other container
+     */
+    template<typename OtherContainer>
+    void insertAll(const OtherContainer& c) {
+        p::insert(c.begin(), c.end());
+    }
+
+    /**
+     * @return true if <code>c</code> container is a subset of this container, false otherwise.
+     */
+    template<typename OtherContainer>
+    bool isSubsetOf(const OtherContainer& c) const noexcept
+    {
+        return aui::container::is_subset(*this, c);
+    }
+
+    /**
+     * Shortcut to <code>insert</code>.
+     * @param rhs value to insert
+     * @return self
+     */
+    self& operator<<(const KeyType& rhs)
+    {
+        p::insert(rhs);
+        return *this;
+    }
+
+    /**
+     * Shortcut to <code>insert</code>.
+     * @param rhs value to insert
+     * @return self
+     */
+    self& operator<<(KeyType&& rhs)
+    {
+        p::insert(std::move(rhs));
+        return *this;
+    }
+
+    /**
+     * Shortcut to <code>erase</code>.
+     * @param rhs value to erase
+     * @return self
+     */
+    self& operator>>(const KeyType& rhs)
+    {
+        p::erase(rhs);
+        return *this;
+    }
+
+    /**
+     * Shortcut to <code>insertAll</code>.
+     * @param c container to insert
+     * @return self
+     */
+    template<typename OtherContainer, std::enable_if_t<!std::is_convertible_v<OtherContainer, KeyType>, bool> = true>
+    self& operator<<(const OtherContainer& c)
+    {
+        insertAll(c);
+        return *this;
+    }
+
+    [[nodiscard]]
+    bool contains(const KeyType& value) const
+    {
+        return p::find(value) != p::end();
+    }
+};
@@ -0,0 +1,37 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include "AMap.h"
+#include "AContainerPrototypes.h"
+#include "detail/flat_map.h"
+
+/**
+ * @brief A map storing elements in a vector sorted by key, with AUI extensions.
+ * @ingroup core
+ * @details
+ * AFlatMap keeps the iteration order of AMap, but lookups are binary searches over contiguous memory instead of
+ * walks over separately allocated tree nodes. Inserting and erasing shift the following elements, so prefer it for
+ * small maps and for maps built once and looked up afterwards, i.e., tables of constants.
+ *
+ * Differences from AMap:
+ * - inserting can invalidate all iterators, pointers and references, as the storage may be reallocated; erasing
+ *   invalidates the ones to the elements at and after the position;
+ * - iterators are random access.
+ */
+template <class KeyType, class ValueType, class Predicate, class Allocator>
+class AFlatMap: public ABaseMap<KeyType, ValueType, aui::detail::flat_map::Map<KeyType, ValueType, Predicate, Allocator>>
+{
+	using parent = ABaseMap<KeyType, ValueType, aui::detail::flat_map::Map<KeyType, ValueType, Predicate, Allocator>>;
+
+	using parent::parent;
+};
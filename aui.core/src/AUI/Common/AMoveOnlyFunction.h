@@ -0,0 +1,180 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+template<typename Signature, std::size_t InplaceStorageSize = 48>
+class AMoveOnlyFunction;
+
+namespace aui::detail {
+    template<typename T>
+    inline constexpr bool is_std_function = false;
+
+    template<typename Signature>
+    inline constexpr bool is_std_function<std::function<Signature>> = true;
+}
+
+/**
+ * @brief Move-only type-erased callable with small buffer optimization.
+ * @tparam Return return type
+ * @tparam Args argument types
+ * @tparam InplaceStorageSize how many bytes of the callable can be stored without dynamic allocation
+ * @ingroup core
+ *
+ * @details
+ * A replacement for std::function optimized for one-shot tasks (thread pool tasks, thread messages, scheduler
+ * callbacks):
+ *
+ * - the callable is not required to be copyable, so move-only state (std::unique_ptr, AFuture with exclusive
+ *   ownership, etc...) can be captured;
+ * - callables that fit in InplaceStorageSize bytes and are nothrow move constructible are stored in place, avoiding
+ *   malloc/free pair per task. Larger callables are allocated dynamically.
+ *
+ * With the default InplaceStorageSize the whole object occupies 64 bytes (one cache line on most platforms).
+ *
+ * Like std::function, operator() is const and invokes the stored callable as non-const.
+ */
+template<typename Return, typename... Args, std::size_t InplaceStorageSize>
+class AMoveOnlyFunction<Return(Args...), InplaceStorageSize> {
+private:
+    struct VTable {
+        Return (*invoke)(void* storage, Args&&... args);
+        void (*move)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template<typename Callable>
+    static constexpr bool IS_INPLACE = sizeof(Callable) <= InplaceStorageSize &&
+                                       alignof(Callable) <= alignof(std::max_align_t) &&
+                                       std::is_nothrow_move_constructible_v<Callable>;
+
+    template<typename Callable>
+    static Callable* callable(void* storage) noexcept {
+        if constexpr (IS_INPLACE<Callable>) {
+            return std::launder(reinterpret_cast<Callable*>(storage));
+        } else {
+            return *reinterpret_cast<Callable**>(storage);
+        }
+    }
+
+    template<typename Callable>
+    static constexpr VTable VTABLE = {
+        [](void* storage, Args&&... args) -> Return {
+            return std::invoke(*callable<Callable>(storage), std::forward<Args>(args)...);
+        },
+        [](void* dst, void* src) noexcept {
+            if constexpr (IS_INPLACE<Callable>) {
+                auto c = callable<Callable>(src);
+                new (dst) Callable(std::move(*c));
+                c->~Callable();
+            } else {
+                *reinterpret_cast<Callable**>(dst) = *reinterpret_cast<Callable**>(src);
+            }
+        },
+        [](void* storage) noexcept {
+            if constexpr (IS_INPLACE<Callable>) {
+                callable<Callable>(storage)->~Callable();
+            } else {
+                delete callable<Callable>(storage);
+            }
+        },
+    };
+
+public:
+    using result_type = Return;
+
+    AMoveOnlyFunction() noexcept = default;
+    AMoveOnlyFunction(std::nullptr_t) noexcept {}
+
+    template<typename Callable>
+        requires(!std::is_same_v<std::decay_t<Callable>, AMoveOnlyFunction> &&
+                 std::is_invocable_r_v<Return, std::decay_t<Callable>&, Args...>)
+    AMoveOnlyFunction(Callable&& callable) {
+        using T = std::decay_t<Callable>;
+        if constexpr (std::is_pointer_v<T> || std::is_member_pointer_v<T> || aui::detail::is_std_function<T>) {
+            // null function pointer or empty std::function
+            if (callable == nullptr) {
+                return;
+            }
+        }
+        if constexpr (IS_INPLACE<T>) {
+            new (&mStorage) T(std::forward<Callable>(callable));
+        } else {
+            *reinterpret_cast<T**>(&mStorage) = new T(std::forward<Callable>(callable));
+        }
+        mVTable = &VTABLE<T>;
+    }
+
+    AMoveOnlyFunction(AMoveOnlyFunction&& rhs) noexcept {
+        moveFrom(rhs);
+    }
+
+    AMoveOnlyFunction(const AMoveOnlyFunction&) = delete;
+    AMoveOnlyFunction& operator=(const AMoveOnlyFunction&) = delete;
+
+    AMoveOnlyFunction& operator=(AMoveOnlyFunction&& rhs) noexcept {
+        if (this != &rhs) {
+            reset();
+            moveFrom(rhs);
+        }
+        return *this;
+    }
+
+    AMoveOnlyFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    ~AMoveOnlyFunction() {
+        reset();
+    }
+
+    Return operator()(Args... args) const {
+        if (mVTable == nullptr) [[unlikely]] {
+            throw std::bad_function_call();
+        }
+        return mVTable->invoke(const_cast<void*>(static_cast<const void*>(&mStorage)), std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]]
+    explicit operator bool() const noexcept {
+        return mVTable != nullptr;
+    }
+
+    [[nodiscard]]
+    bool operator==(std::nullptr_t) const noexcept {
+        return mVTable == nullptr;
+    }
+
+private:
+    alignas(std::max_align_t) std::byte mStorage[InplaceStorageSize];
+    const VTable* mVTable = nullptr;
+
+    void reset() noexcept {
+        if (mVTable) {
+            mVTable->destroy(&mStorage);
+            mVTable = nullptr;
+        }
+    }
+
+    void moveFrom(AMoveOnlyFunction& rhs) noexcept {
+        if (rhs.mVTable) {
+            rhs.mVTable->move(&mStorage, &rhs.mStorage);
+            mVTable = std::exchange(rhs.mVTable, nullptr);
+        }
+    }
+};
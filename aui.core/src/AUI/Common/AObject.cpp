@@ -21,6 +21,10 @@ AObject::AObject() { mAttachedThread = AThread::current(); }
 
 bool& AObject::isDisconnected() { return gIsDisconnected; }
 
+bool AObject::isOnCurrentThread() const noexcept {
+    return mAttachedThread != nullptr && mAttachedThread->getId() == std::this_thread::get_id();
+}
+
 void AObject::moveToThread(aui::no_escape<AObject> object, _<AAbstractThread> thread) {
     object->setThread(std::move(thread));
 }
@@ -109,6 +109,41 @@ public:
         return connect(property.changed, object, std::move(lambda));
     }
 
+    /**
+     * @brief Connects signal to the slot of the specified object, coalescing cross-thread slot calls.
+     * @ingroup signal_slot
+     * @details
+     * See aui::coalesce.
+     * @code{cpp}
+     * connect(worker->progress, progressBar, [progressBar](float p) { progressBar->setValue(p); }, aui::coalesce);
+     * @endcode
+     * @param signal signal
+     * @param object instance of <code>AObject</code>
+     * @param function slot. Can be lambda
+     * @return Connection instance
+     */
+    template <AAnySignal Signal, aui::derived_from<AObjectBase> Object, ACompatibleSlotFor<Signal> Function>
+    static decltype(auto) connect(const Signal& signal, Object* object, Function&& function, aui::coalesce_t) {
+        return const_cast<Signal&>(signal).connect(
+            object, aui::detail::makeLambda(object, std::forward<Function>(function)), true);
+    }
+
+    /**
+     * @brief Connects property to the slot of the specified object, coalescing cross-thread slot calls.
+     * @ingroup property_system
+     * @details
+     * Pre-fires the slot with the current value of the property, like the regular connect does. See aui::coalesce.
+     * @param property property
+     * @param object instance of <code>AObject</code>
+     * @param function slot. Can be lambda
+     */
+    template <AAnyProperty Property, aui::derived_from<AObjectBase> Object, typename Function>
+    static decltype(auto) connect(const Property& property, Object* object, Function&& function, aui::coalesce_t) {
+        auto lambda = aui::detail::makeLambda(object, std::forward<Function>(function));
+        property.changed.makeRawInvocable(lambda)(*property);
+        return connect(property.changed, object, std::move(lambda), aui::coalesce);
+    }
+
     /**
      * @brief Connects source property to the destination property.
      * @ingroup property_system
@@ -251,6 +286,44 @@ public:
         return connect(connectable, slotDef.boundObject, std::move(slotDef.invocable));
     }
 
+    /**
+     * @brief Connects signal or property to the slot of the specified object, coalescing cross-thread slot calls.
+     * @ingroup signal_slot
+     * @details
+     * See aui::coalesce.
+     * @code{cpp}
+     * connect(worker->progress, slot(progressBar)::setValue, aui::coalesce);
+     * @endcode
+     */
+    template <AAnySignalOrProperty Connectable, aui::derived_from<AObjectBase> Object, typename Function>
+    static decltype(auto)
+    connect(const Connectable& connectable, ASlotDef<Object*, Function> slotDef, aui::coalesce_t) {
+        return connect(connectable, slotDef.boundObject, std::move(slotDef.invocable), aui::coalesce);
+    }
+
+    /**
+     * @brief Connects signal or property to the slot of the specified object, coalescing cross-thread slot calls.
+     * @ingroup signal_slot
+     * @details
+     * See aui::coalesce.
+     */
+    template <AAnySignalOrProperty Connectable, aui::derived_from<AObjectBase> Object, ACompatibleSlotFor<Connectable> Function>
+    static decltype(auto)
+    connect(const Connectable& connectable, _<Object> object, Function&& function, aui::coalesce_t) {
+        return connect(connectable, object.get(), std::forward<Function>(function), aui::coalesce);
+    }
+
+    /**
+     * @brief Connects signal or property to slot of \c "this" object, coalescing cross-thread slot calls.
+     * @ingroup signal_slot
+     * @details
+     * See aui::coalesce.
+     */
+    template <typename Connectable, ACompatibleSlotFor<Connectable> Function>
+    decltype(auto) connect(const Connectable& connectable, Function&& function, aui::coalesce_t) {
+        return connect(connectable, this, std::forward<Function>(function), aui::coalesce);
+    }
+
     /**
      * @brief Connects signal or property to the slot of the specified non-AObject type.
      * @ingroup property_system
@@ -291,6 +364,13 @@ public:
 
     _<AAbstractThread> getThread() const { return mAttachedThread; }
 
+    /**
+     * @return whether the object's thread is the calling thread.
+     * @details
+     * Equivalent to <code>getThread() == AThread::current()</code> but does not copy shared pointers.
+     */
+    [[nodiscard]] bool isOnCurrentThread() const noexcept;
+
     bool isSlotsCallsOnlyOnMyThread() const noexcept { return mSlotsCallsOnlyOnMyThread; }
 
     static void moveToThread(aui::no_escape<AObject> object, _<AAbstractThread> thread);
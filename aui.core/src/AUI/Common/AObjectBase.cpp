@@ -13,15 +13,52 @@
 #include "AAbstractSignal.h"
 #include "AObjectBase.h"
 #include "AUI/Logging/ALogger.h"
+#include <algorithm>
+#include <functional>
+#include <vector>
 
-ASpinlockMutex AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC;
+AObjectBase::~AObjectBase() {
+    clearAllIngoingConnections();
+}
 
 void AObjectBase::clearAllIngoingConnections() noexcept {
-    auto incomingConnections = [&] {
-      std::unique_lock lock(SIGNAL_SLOT_GLOBAL_SYNC);
+    using namespace aui::detail::signal;
+    auto& receiverStripe = SyncStripes::of(this);
+    auto ingoingConnections = [&] {
+      std::unique_lock lock(receiverStripe);
       return std::exchange(mIngoingConnections, {});
     }();
-    incomingConnections.clear();
+    if (ingoingConnections.empty()) {
+        return;
+    }
+
+    using Entry = std::pair<ASpinlockMutex*, AAbstractSignal::Connection*>;
+    std::vector<Entry, ConnectionPool::Allocator<Entry>> bySender;
+    try {
+        bySender.reserve(ingoingConnections.size());
+    } catch (...) {
+        // the connections are broken one by one then.
+        return;
+    }
+    for (const auto& connection : ingoingConnections) {
+        bySender.emplace_back(&connection.value->senderStripe(), connection.value.get());
+    }
+    std::sort(bySender.begin(), bySender.end(), [](const Entry& lhs, const Entry& rhs) {
+        return std::less<>{}(lhs.first, rhs.first);
+    });
+
+    for (auto group = bySender.begin(); group != bySender.end();) {
+        auto& senderStripe = *group->first;
+        SyncStripes::PairGuard lock(senderStripe, receiverStripe);
+        for (; group != bySender.end() && group->first == &senderStripe; ++group) {
+            group->second->onBeforeReceiverSideDestroyedLocked();
+        }
+    }
+
+    // the connections are unlinked from both sides already; release them without breaking them once more.
+    for (auto& connection : ingoingConnections) {
+        connection.value = nullptr;
+    }
 }
 
 void AObjectBase::handleSlotException(std::exception_ptr exception) {
@@ -31,11 +31,9 @@ class API_AUI_CORE AObjectBase {
     friend class PropertyPrecomputedTest;
 
 public:
-    virtual ~AObjectBase() = default;
+    virtual ~AObjectBase();
     AObjectBase() = default;
 
-    static ASpinlockMutex SIGNAL_SLOT_GLOBAL_SYNC;
-
     AObjectBase(AObjectBase&& rhs) noexcept {
         operator=(std::move(rhs));
     }
@@ -58,6 +56,12 @@ public:
     }
 
 protected:
+    /**
+     * @brief Breaks all connections to this object.
+     * @details
+     * Connections are grouped by the stripes of their senders, so each stripe is locked once rather than per
+     * connection.
+     */
     void clearAllIngoingConnections() noexcept;
 
     /**
@@ -108,5 +112,9 @@ private:
         }
     };
 
-    AVector<ReceiverConnectionOwner> mIngoingConnections;
+    /**
+     * @brief Connections to this object. Allocated from the connection pool, as the connections themselves.
+     */
+    AVector<ReceiverConnectionOwner, aui::detail::signal::ConnectionPool::Allocator<ReceiverConnectionOwner>>
+        mIngoingConnections;
 };
@@ -75,7 +75,15 @@ struct APropertyPrecomputed final : aui::react::DependencyObserver {
      * updates a property expression depends on.
      */
     void invalidate() override {
+        markDirty();
+        propagate();
+    }
+
+    void markDirty() override {
         mCurrentValue.reset();
+    }
+
+    void propagate() override {
         if (this->changed) {
             if (this->changed.isAtSignalEmissionState()) {
                 mCurrentValue.setEvaluationLoopTrap();
@@ -91,8 +99,10 @@ struct APropertyPrecomputed final : aui::react::DependencyObserver {
 
     [[nodiscard]]
     const T& value() const {
-        aui::react::DependencyObserverRegistrar::addDependency(changed);
-        return mCurrentValue;
+        // evaluate first, so the height is up to date.
+        const T& result = mCurrentValue;
+        aui::react::DependencyObserverRegistrar::addDependency(changed, height());
+        return result;
     }
 
     [[nodiscard]]
@@ -13,7 +13,10 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <optional>
 #include "AUI/Common/ADeque.h"
+#include "AUI/Common/AMoveOnlyFunction.h"
 #include "AUI/Common/AObject.h"
 #include "AUI/Thread/AMutex.h"
 #include "AAbstractSignal.h"
@@ -109,7 +112,7 @@ struct ProjectedSignal {
         std::conditional_t<IS_PROJECTION_RETURNS_TUPLE, projection_returns_t, std::tuple<projection_returns_t>>;
 
     template <convertible_to<AObjectBase*> Object, not_overloaded_lambda Lambda>
-    void connect(Object objectBase, Lambda&& lambda) {
+    void connect(Object objectBase, Lambda&& lambda, bool coalesce = false) {
         base.connect(
             objectBase,
             tuple_visitor<typename projection_info_t::args>::for_each_all([&]<typename... ProjectionArgs>() {
@@ -122,7 +125,8 @@ struct ProjectedSignal {
                         std::invoke(invocable, std::move(result));
                     }
                 };
-            }));
+            }),
+            coalesce);
     }
 
     operator bool() const { return bool(base); }
@@ -196,7 +200,19 @@ public:
         return *this;
     }
 
-    virtual ~ASignal() noexcept = default;
+    virtual ~ASignal() noexcept {
+        if (mEmission.destroyed) {
+            // a slot destroys the signal during its emission; the connections being emitted must not refer to it, as
+            // disconnecting them would look the signal up.
+            *mEmission.destroyed = true;
+            std::unique_lock lock(sync());
+            for (const auto& connection : *mEmission.connections) {
+                if (connection.value) {
+                    connection.value->sender = nullptr;
+                }
+            }
+        }
+    }
 
     /**
      * @brief Check whether signal contains any connected slots or not.
@@ -207,7 +223,13 @@ public:
      */
     operator bool() const { return hasOutgoingConnections(); }
 
-    void clearAllOutgoingConnections() const noexcept override { mOutgoingConnections.clear(); }
+    void clearAllOutgoingConnections() const noexcept override {
+        auto outgoingConnections = [&] {
+            std::unique_lock lock(sync());
+            return std::exchange(mOutgoingConnections, {});
+        }();
+        outgoingConnections.clear();
+    }
     void clearAllOutgoingConnectionsWith(aui::no_escape<AObjectBase> object) const noexcept override {
         clearOutgoingConnectionsIf([&](const _<ConnectionImpl>& p) { return p->receiverBase == object.ptr(); });
     }
@@ -217,6 +239,7 @@ public:
     }
 
     [[nodiscard]] bool hasOutgoingConnectionsWith(aui::no_escape<AObjectBase> object) const noexcept override {
+        std::unique_lock lock(sync());
         return std::any_of(
             mOutgoingConnections.begin(), mOutgoingConnections.end(),
             [&](const SenderConnectionOwner& s) { return s.value->receiverBase == object.ptr(); });
@@ -232,14 +255,14 @@ private:
         friend class ASignal;
 
         void disconnect() override {
-            std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
-            unlinkInSenderSideOnly(lock);
-            if (!lock.owns_lock()) lock.lock();
-            unlinkInReceiverSideOnly(lock);
-
-            receiverBase = nullptr;
-            receiver = nullptr;
-            sender = nullptr;
+            // stolen ownerships are released after unlocking, as releasing might destroy this connection.
+            _<ConnectionImpl> senderSide;
+            _<Connection> receiverSide;
+            {
+                auto lock = lockBothSides();
+                senderSide = unlinkInSenderSideOnly();
+                receiverSide = unlinkInReceiverSideOnly();
+            }
         }
 
     private:
@@ -268,10 +291,37 @@ private:
          */
         AObject* receiver = nullptr;
 
+        /**
+         * @brief Stripes of the sender signal and the receiver object.
+         * @details
+         * Computed once on connection creation, so they remain valid after sender or receiver is nulled.
+         */
+        ASpinlockMutex* senderSync = nullptr;
+        ASpinlockMutex* receiverSync = nullptr;
+
         /**
          * @brief Receiver's signal handler.
+         * @details
+         * Handlers of typical size are stored in place, so the connection takes a single pooled block.
+         */
+        AMoveOnlyFunction<void(const Args&...)> func;
+
+        /**
+         * @brief Pending cross-thread call of a connection made with aui::coalesce.
+         */
+        struct Coalesced {
+            ASpinlockMutex sync;
+
+            /**
+             * @brief Arguments of the pending call. Empty if there's no pending call.
+             */
+            std::optional<std::tuple<std::decay_t<Args>...>> pendingArgs;
+        };
+
+        /**
+         * @brief Non-null if the connection was made with aui::coalesce.
          */
-        func_t func;
+        std::unique_ptr<Coalesced> coalesced;
 
         /**
          * @brief Whether is connection to be removed.
@@ -282,29 +332,44 @@ private:
          */
         bool toBeRemoved = false;
 
+        [[nodiscard]]
+        aui::detail::signal::SyncStripes::PairGuard lockBothSides() const noexcept {
+            return { *senderSync, *receiverSync };
+        }
+
         /**
          * @brief Breaks connection in the receiver side.
          * @details
          * Called when `ASignal` has cleaned its connection instance.
          *
-         * This cleanup function assumes that an appropriate clean action for the sender side is taken.
+         * This cleanup function assumes that an appropriate clean action for the sender side is taken. Both sides
+         * should be locked.
+         * @return ownership of the connection stolen from the receiver. Should be released after unlocking.
          */
-        void unlinkInReceiverSideOnly(std::unique_lock<ASpinlockMutex>& lock) {
+        [[nodiscard]]
+        _<Connection> unlinkInReceiverSideOnly() {
             toBeRemoved = true;
 
             auto receiverLocal = std::exchange(receiverBase, nullptr);
             if (!receiverLocal) {
-                return;
+                return nullptr;
             }
             receiver = nullptr;
-            removeIngoingConnectionIn(receiverLocal, *this, lock);
+            return removeIngoingConnectionIn(receiverLocal, *this);
         }
 
-        void unlinkInSenderSideOnly(std::unique_lock<ASpinlockMutex>& lock) {
+        /**
+         * @brief Breaks connection in the sender side.
+         * @details
+         * Both sides should be locked.
+         * @return ownership of the connection stolen from the sender. Should be released after unlocking.
+         */
+        [[nodiscard]]
+        _<ConnectionImpl> unlinkInSenderSideOnly() {
             toBeRemoved = true;
             auto localSender = std::exchange(sender, nullptr);
             if (!localSender) {
-                return;
+                return nullptr;
             }
 
             // As we marked toBeRemoved, we are not required to do anything further. However, we can perform a cheap
@@ -316,21 +381,42 @@ private:
             if (it == localSender->mOutgoingConnections.end()) {
                 // It can happen probably when another thread is performing invocation on this signal and stole the
                 // mOutgoingConnections array.
-                return;
+                return nullptr;
             }
             // it->value may be unique owner of this, let's steal the ownership before erasure to keep things safe.
             auto self = std::exchange(it->value, nullptr);
             localSender->mOutgoingConnections.erase(it);
-            lock.unlock();
+            return self;
         }
 
         void onBeforeReceiverSideDestroyed() override {
-            std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
+            _<ConnectionImpl> senderSide;
+            {
+                auto lock = lockBothSides();
+                senderSide = unlinkDestroyedReceiver();
+            }
+        }
+
+        void onBeforeReceiverSideDestroyedLocked() noexcept override {
+            // the caller holds another reference, so releasing the stolen one under the locks does not destroy this.
+            auto senderSide = unlinkDestroyedReceiver();
+        }
+
+        ASpinlockMutex& senderStripe() const noexcept override {
+            return *senderSync;
+        }
+
+        /**
+         * @brief Breaks connection with the receiver being destroyed. Both sides should be locked.
+         * @return ownership of the connection stolen from the sender. Should be released after unlocking.
+         */
+        [[nodiscard]]
+        _<ConnectionImpl> unlinkDestroyedReceiver() {
             // this function can be called by receiver's AObject cleanup functions (presumably, destructor), so we
             // assume receiver (and thus receiverBase) are invalid.
             receiver = nullptr;
             receiverBase = nullptr;
-            unlinkInSenderSideOnly(lock);
+            return unlinkInSenderSideOnly();
         }
     };
 
@@ -370,41 +456,85 @@ private:
             if (!value) {
                 return;
             }
-            std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
-            // this destructor can be called in ASignal destructor, so it's worth to reset the sender as well.
-            value->sender = nullptr;
-            value->unlinkInReceiverSideOnly(lock);
+            _<Connection> receiverSide;
+            {
+                auto lock = value->lockBothSides();
+                // this destructor can be called in ASignal destructor, so it's worth to reset the sender as well.
+                value->sender = nullptr;
+                receiverSide = value->unlinkInReceiverSideOnly();
+            }
             value = nullptr;
         }
     };
 
+    /**
+     * @brief Outgoing connections. Guarded by sync().
+     * @details
+     * Owners must not be released with sync() locked, as releasing locks the connection's sides.
+     */
     mutable AVector<SenderConnectionOwner> mOutgoingConnections;
     ASpinlockMutex mLoopGuard;
 
+    /**
+     * @brief State of the running emission, if any.
+     */
+    struct Emission {
+        /**
+         * @brief Set by the destructor when a slot destroys the signal (i.e., its sender), so the emission goes on
+         * without touching the signal. Guarded by mLoopGuard.
+         */
+        bool* destroyed = nullptr;
+
+        /**
+         * @brief Connections being emitted. Their sender is reset by the destructor.
+         */
+        AVector<SenderConnectionOwner>* connections = nullptr;
+
+        Emission() = default;
+        Emission(const Emission&) noexcept {}
+        Emission& operator=(const Emission&) noexcept { return *this; }
+    } mEmission;
+
+    [[nodiscard]]
+    ASpinlockMutex& sync() const noexcept {
+        return aui::detail::signal::SyncStripes::of(this);
+    }
+
     void invokeSignal(AObject* sender, std::tuple<const Args&...> args = {});
 
+    /**
+     * @brief Calls the slot of a connection on the receiver's thread.
+     */
+    static void invokeQueued(
+        const _weak<AObject>& senderWeakPtr, const _weak<AObject>& receiverWeakPtr, ConnectionImpl& connection,
+        const std::tuple<std::decay_t<Args>...>& args);
+
     template <aui::convertible_to<AObjectBase*> Object, aui::not_overloaded_lambda Lambda>
-    const _<ConnectionImpl>& connect(Object objectBase, Lambda&& lambda) {
+    _<ConnectionImpl> connect(Object objectBase, Lambda&& lambda, bool coalesce = false) {
         AObject* object = nullptr;
         if constexpr (std::is_base_of_v<AObject, std::remove_pointer_t<Object>>) {
             object = objectBase;
         }
-        const auto& connection = [&]() -> _<ConnectionImpl>& {
-            auto conn = _new<ConnectionImpl>();
-            conn->sender = this;
-            conn->receiverBase = objectBase;
-            conn->receiver = object;
-            conn->func = makeRawInvocable(std::forward<Lambda>(lambda));
-            std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
-
-            std::erase_if(mOutgoingConnections, [](const SenderConnectionOwner& o) {
-                return o.value == nullptr;
-            });
-
-            return mOutgoingConnections.emplace_back(std::move(conn)).value;
-        }();
-        if (objectBase != AObject::GENERIC_OBSERVER) {
-            addIngoingConnectionIn(objectBase, connection);
+        AObjectBase* receiverBase = objectBase;
+        _<ConnectionImpl> connection = std::allocate_shared<ConnectionImpl>(
+            aui::detail::signal::ConnectionPool::Allocator<ConnectionImpl>());
+        connection->sender = this;
+        connection->receiverBase = receiverBase;
+        connection->receiver = object;
+        connection->senderSync = &sync();
+        connection->receiverSync = &aui::detail::signal::SyncStripes::of(receiverBase);
+        connection->func = makeRawInvocable(std::forward<Lambda>(lambda));
+        if (coalesce) {
+            connection->coalesced = std::make_unique<typename ConnectionImpl::Coalesced>();
+        }
+
+        auto lock = connection->lockBothSides();
+        std::erase_if(mOutgoingConnections, [](const SenderConnectionOwner& o) {
+            return o.value == nullptr;
+        });
+        mOutgoingConnections.emplace_back(connection);
+        if (receiverBase != AObject::GENERIC_OBSERVER) {
+            addIngoingConnectionIn(receiverBase, connection);
         }
         return connection;
     }
@@ -430,6 +560,7 @@ private:
          */
         AVector<SenderConnectionOwner> slotsToRemove;
 
+        std::unique_lock lock(sync());
         slotsToRemove.reserve(mOutgoingConnections.size());
         mOutgoingConnections.removeIf([&slotsToRemove, predicate = std::move(predicate)](SenderConnectionOwner& p) {
             if (predicate(p.value)) {
@@ -438,6 +569,7 @@ private:
             }
             return false;
         });
+        lock.unlock();
 
         slotsToRemove.clear();
     }
@@ -449,25 +581,31 @@ void ASignal<Args...>::invokeSignal(AObject* sender, std::tuple<const Args&...>
     if (mOutgoingConnections.empty())
         return;
 
-    _<AObject> senderPtr, receiverPtr;
-
-    if (sender != nullptr) {
-        if (auto sharedPtr = weakPtrFromObject(sender).lock()) {   // avoid sender removal during signal processing
-            senderPtr = std::move(static_cast<_<AObject>>(sharedPtr));
-        }
-    }
-
-    std::unique_lock lock(AObjectBase::SIGNAL_SLOT_GLOBAL_SYNC);
+    std::unique_lock lock(sync());
     std::unique_lock lock2(mLoopGuard, std::try_to_lock);
     if (!lock2.owns_lock()) {
         throw AEvaluationLoopException();
     }
-    auto outgoingConnections = std::move(mOutgoingConnections);   // needed to safely iterate through the slots
+
+    // Moving the connections out is allocation free and lets slots connect to this signal during emission. Connections
+    // are owned by outgoingConnections during emission, so none of them is destroyed during a slot call. The sender is
+    // not pinned: if a slot destroys it (and thus this signal), the destructor sets senderDestroyed and detaches
+    // outgoingConnections from the signal, and the emission goes on without touching the signal or the sender.
+    bool senderDestroyed = false;
+    auto outgoingConnections = std::move(mOutgoingConnections);
+    mEmission.destroyed = &senderDestroyed;
+    mEmission.connections = &outgoingConnections;
     ARaiiHelper returnBack = [&] {
+        if (senderDestroyed) {
+            // the remaining connections are released with outgoingConnections, which locks the stripes; the stripes
+            // outlive the signal, but mLoopGuard is gone.
+            if (lock.owns_lock()) lock.unlock();
+            lock2.release();
+            return;
+        }
+        mEmission.destroyed = nullptr;
+        mEmission.connections = nullptr;
         if (!lock.owns_lock()) lock.lock();
-        AUI_MARK_AS_USED(senderPtr);
-        AUI_MARK_AS_USED(receiverPtr);
-
         if (mOutgoingConnections.empty()) {
             mOutgoingConnections = std::move(outgoingConnections);
         } else {
@@ -478,65 +616,70 @@ void ASignal<Args...>::invokeSignal(AObject* sender, std::tuple<const Args&...>
         }
     };
     for (auto i = outgoingConnections.begin(); i != outgoingConnections.end();) {
-        _<ConnectionImpl>& outgoingConnection = i->value;
+        ConnectionImpl& outgoingConnection = *i->value;
         if (!lock.owns_lock()) lock.lock();
-        if (outgoingConnection->toBeRemoved) {
+        if (outgoingConnection.toBeRemoved) {
             lock.unlock();
             i = outgoingConnections.erase(i);
             continue;
         }
-        _weak<AObject> receiverWeakPtr;
-        if (outgoingConnection->receiver != nullptr) {
-            receiverWeakPtr = weakPtrFromObject(outgoingConnection->receiver);
-            if (outgoingConnection->receiver->isSlotsCallsOnlyOnMyThread() &&
-                outgoingConnection->receiver->getThread() != AThread::current()) {
-                // perform crossthread call; should make weak ptr to the object and queue call to thread message queue
-
-                /*
-                 * shared_ptr counting mechanism is used when doing a crossthread call.
-                 * It could not track the object existence without shared_ptr block.
-                 * Also, receiverWeakPtr.lock() may be null here because object is in different thread and being
-                 * destructed by shared_ptr but have not reached clearAllIngoingConnections() yet.
-                 */
-                if (receiverWeakPtr.lock() != nullptr) {
-                    outgoingConnection->receiver->getThread()->enqueue(
-                        [senderWeakPtr = senderPtr.weak(),
+        AObject* receiver = outgoingConnection.receiver;
+        if (receiver != nullptr && receiver->isSlotsCallsOnlyOnMyThread() && !receiver->isOnCurrentThread()) {
+            // perform crossthread call; should make weak ptr to the object and queue call to thread message queue
+
+            /*
+             * shared_ptr counting mechanism is used when doing a crossthread call.
+             * It could not track the object existence without shared_ptr block.
+             * Also, receiverWeakPtr.lock() may be null here because object is in different thread and being
+             * destructed by shared_ptr but have not reached clearAllIngoingConnections() yet.
+             */
+            _weak<AObject> receiverWeakPtr = receiver->weakPtr();
+            if (receiverWeakPtr.lock() == nullptr) {
+                ++i;
+                continue;
+            }
+            if (auto coalesced = outgoingConnection.coalesced.get()) {
+                // replace arguments of the pending call, if any; otherwise, queue a new one.
+                std::unique_lock coalescedLock(coalesced->sync);
+                bool isPending = coalesced->pendingArgs.has_value();
+                coalesced->pendingArgs = aui::detail::signal::makeTupleOfCopies(args);
+                coalescedLock.unlock();
+                if (!isPending) {
+                    receiver->getThread()->enqueue(
+                        [senderWeakPtr = sender != nullptr ? sender->weakPtr() : _weak<AObject>(),
                          receiverWeakPtr = std::move(receiverWeakPtr),
-                         connection = outgoingConnection,
-                         args = aui::detail::signal::makeTupleOfCopies(args)] {
-                            static_assert(
-                                std::is_same_v<std::tuple<std::decay_t<Args>...>, std::remove_const_t<decltype(args)>>,
-                                "when performing a cross thread call, args is expected to hold values "
-                                "instead of references");
-                            auto receiverPtr = receiverWeakPtr.lock();
-                            if (!receiverPtr) {
-                                // receiver was destroyed while we were transferring the call to another thread.
-                                return;
-                            }
-
-                            AObject::isDisconnected() = false;
-                            ARaiiHelper h = [&] {
-                                if (AObject::isDisconnected()) {
-                                    connection->disconnect();
-                                }
-                            };
-                            try {
-                                (std::apply)(connection->func, args);
-                            } catch (...) {
-                                if (auto senderPtr = senderWeakPtr.lock()) {
-                                    senderPtr->handleSlotException(std::current_exception());
-                                }
-                            }
+                         connection = i->value] {
+                            auto args = [&] {
+                                std::unique_lock lock(connection->coalesced->sync);
+                                auto result = std::move(*connection->coalesced->pendingArgs);
+                                connection->coalesced->pendingArgs.reset();
+                                return result;
+                            }();
+                            invokeQueued(senderWeakPtr, receiverWeakPtr, *connection, args);
                         });
                 }
-                ++i;
-                continue;
+            } else {
+                receiver->getThread()->enqueue(
+                    [senderWeakPtr = sender != nullptr ? sender->weakPtr() : _weak<AObject>(),
+                     receiverWeakPtr = std::move(receiverWeakPtr),
+                     connection = i->value,
+                     args = aui::detail::signal::makeTupleOfCopies(args)] {
+                        static_assert(
+                            std::is_same_v<std::tuple<std::decay_t<Args>...>, std::remove_const_t<decltype(args)>>,
+                            "when performing a cross thread call, args is expected to hold values "
+                            "instead of references");
+                        invokeQueued(senderWeakPtr, receiverWeakPtr, *connection, args);
+                    });
             }
+            ++i;
+            continue;
         }
-        AObject::isDisconnected() = false;
 
-        if (auto sharedPtr = receiverWeakPtr.lock()) {   // avoid receiver removal during signal processing
-            receiverPtr = std::move(sharedPtr);
+        // Same thread call. The receiver is pinned, as the slot (or another thread) may release the last reference to
+        // it during the call. Signals of properties and generic observers have no receiver to pin.
+        _<AObject> receiverPtr;
+        if (receiver != nullptr) {
+            receiverPtr = receiver->weakPtr().lock();
         }
 
         if constexpr (std::tuple_size_v<std::remove_cvref_t<decltype(args)>> > 0) {
@@ -552,14 +695,22 @@ void ASignal<Args...>::invokeSignal(AObject* sender, std::tuple<const Args&...>
             check_and_assert_lambda(args);
         }
         lock.unlock();
+        auto& disconnected = AObject::isDisconnected();
+        disconnected = false;
         try {
-            (std::apply)(outgoingConnection->func, args);
+            (std::apply)(outgoingConnection.func, args);
         } catch (...) {
-            if (senderPtr) {
-                senderPtr->handleSlotException(std::current_exception());
+            if (sender != nullptr && !senderDestroyed) {
+                sender->handleSlotException(std::current_exception());
             }
         }
-        if (AObject::isDisconnected()) {
+        // release the pin before relocking: destruction of the receiver breaks its connections, which locks stripes.
+        receiverPtr = nullptr;
+        if (senderDestroyed) {
+            // the remaining slots are still called, as if the sender was destroyed right after the emission.
+            sender = nullptr;
+        }
+        if (disconnected) {
             i = outgoingConnections.erase(i);
             continue;
         }
@@ -567,6 +718,31 @@ void ASignal<Args...>::invokeSignal(AObject* sender, std::tuple<const Args&...>
     }
 }
 
+template <typename... Args>
+void ASignal<Args...>::invokeQueued(
+    const _weak<AObject>& senderWeakPtr, const _weak<AObject>& receiverWeakPtr, ConnectionImpl& connection,
+    const std::tuple<std::decay_t<Args>...>& args) {
+    auto receiverPtr = receiverWeakPtr.lock();
+    if (!receiverPtr) {
+        // receiver was destroyed while we were transferring the call to another thread.
+        return;
+    }
+
+    AObject::isDisconnected() = false;
+    ARaiiHelper h = [&] {
+        if (AObject::isDisconnected()) {
+            connection.disconnect();
+        }
+    };
+    try {
+        (std::apply)(connection.func, args);
+    } catch (...) {
+        if (auto senderPtr = senderWeakPtr.lock()) {
+            senderPtr->handleSlotException(std::current_exception());
+        }
+    }
+}
+
 /**
  * @brief A signal declaration.
  * @tparam Args signal arguments
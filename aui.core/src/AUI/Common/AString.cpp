@@ -12,111 +12,59 @@
 #include <cstring>
 #include "AString.h"
 #include "AStringVector.h"
-#include "AStaticVector.h"
 #include <AUI/Common/AByteBuffer.h>
+#include <AUI/Common/detail/casemap.h>
+#include <AUI/Common/detail/utf.h>
 
 // utf8 stuff has a lot of magic
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
 
-inline static AStaticVector<char16_t, 4> toUtf16(char32_t i) {
-    if (i <= 0xffff) {
-        return { char16_t(i) };
-    }
-
-    i -= 0x10000;
-    return { char16_t((i >> 10) + 0xD800),
-             char16_t((i & 0x3FF) + 0xDC00) };
-}
-
-template<typename T>
-inline static char32_t fromUtf16(T& iterator, T last) {
-    auto c1 = *(iterator++);
-    if (iterator == last) {
-        // incomplete sequence?
-        return static_cast<char32_t >(c1);
-    }
-    if (*iterator < 0xD800) {
-        return static_cast<char32_t >(c1);
+inline static void fromUtf8_impl(AString& destination, const char* str, size_t length) {
+    if (length == 0) {
+        return;
     }
-    auto c2 = *(iterator++);
-
-    if (c2 < 0xDC00) {
-        // bad entity
+    // decoding stops at the null terminator.
+    if (auto terminator = static_cast<const char*>(std::memchr(str, 0, length))) {
+        length = terminator - str;
     }
-
-    c1 -= 0xD800;
-    c2 -= 0xDC00;
-
-    return (char32_t(c1) << 10 | char32_t(c2 & 0x3FF)) + 0x10000;
-}
-
-inline static void fromUtf8_impl(AString& destination, const char* str, size_t length) {
-    destination.reserve(length);
-
-    // parse utf8
-    for (; length && *str; --length)
-    {
-        if ((*str & 0b1000'0000) == 0) {
-            // ascii symbol
-            destination.push_back(*(str++));
-            continue;
-        }
-        // utf8 symbol
-
-        if ((*str & 0b1110'0000) == 0b1100'0000) {
-            // 2-byte symbol
-            char16_t t = *(str++) & 0b11111;
-            t <<= 6;
-            t |= *(str++) & 0b111111;
-            destination.push_back(t);
-            length -= 1;
-            continue;
-        }
-
-        if ((*str & 0b1111'0000) == 0b1110'0000) {
-            // 3-byte symbol
-            char16_t t = *(str++) & 0b1111;
-            t <<= 6;
-            t |= *(str++) & 0b111111;
-            t <<= 6;
-            t |= *(str++) & 0b111111;
-            destination.push_back(t);
-            length -= 2;
-            continue;
-        }
-
-        if ((*str & 0b1111'1000) == 0b1111'0000) {
-            // 4-byte symbol
-            char32_t t = *(str++) & 0b111;
-            t <<= 6;
-            t |= *(str++) & 0b111111;
-            t <<= 6;
-            t |= *(str++) & 0b111111;
-            t <<= 6;
-            t |= *(str++) & 0b111111;
-            destination.insertAll(toUtf16(t));
-            length -= 3;
-            continue;
-        }
-
-
-        str++; // bad entity?
+    // a byte never decodes to more than one code unit; for ASCII input, the size is exact.
+    auto offset = destination.size();
+    destination.resize(offset + length);
+    destination.resize(offset + aui::detail::utf::utf8ToUtf16({ str, length }, destination.data() + offset));
+}
+
+/**
+ * @brief fromUtf8_impl for a string being constructed.
+ * @details
+ * The buffer is sized by the input bytes; mostly non-ASCII input (i.e., 2 or 3 bytes per code unit) would keep up to
+ * 3x capacity, so the string is shrunk then. ASCII input is never shrunk, and neither are appends, which keep their
+ * capacity to stay amortized.
+ */
+inline static void fromUtf8_construct(AString& destination, const char* str, size_t length) {
+    fromUtf8_impl(destination, str, length);
+    if (length - destination.size() > destination.size() / 2) {
+        destination.shrink_to_fit();
     }
 }
 
 AString::AString(const char* utf8) noexcept
 {
-    fromUtf8_impl(*this, utf8, std::strlen(utf8));
+    fromUtf8_construct(*this, utf8, std::strlen(utf8));
 }
 
 AString::AString(std::string_view utf8) noexcept
 {
-    fromUtf8_impl(*this, utf8.data(), utf8.length());
+    fromUtf8_construct(*this, utf8.data(), utf8.length());
 }
 
 AString::AString(const std::string& utf8) noexcept
 {
-    fromUtf8_impl(*this, utf8.c_str(), utf8.length());
+    fromUtf8_construct(*this, utf8.c_str(), utf8.length());
+}
+
+AString& AString::appendUtf8(std::string_view utf8) noexcept {
+    fromUtf8_impl(*this, utf8.data(), utf8.size());
+    return *this;
 }
 
 AString AString::fromUtf8(const AByteBufferView& buffer) {
@@ -125,59 +73,17 @@ AString AString::fromUtf8(const AByteBufferView& buffer) {
 
 AString AString::fromUtf8(const char* buffer, size_t length) {
     AString result;
-    fromUtf8_impl(result, buffer, length);
+    fromUtf8_construct(result, buffer, length);
     return result;
 }
 
 
 AByteBuffer AString::toUtf8() const noexcept
 {
+    std::u16string_view utf16(data(), size());
     AByteBuffer buf;
-    for (auto it = begin(); it != end();)
-    {
-        auto c = *it;
-        if (c < 0x80) {
-            buf << static_cast<char>(c);
-            ++it;
-            continue;
-        }
-
-        if (c < 0x800) {
-            char b[] = {
-                static_cast<char>(0b11000000 | (c >> 6 & 0b11111)),
-                static_cast<char>(0b10000000 | (c      & 0b111111)),
-                0,
-            };
-            buf << b;
-            ++it;
-            continue;
-        }
-
-        if (c < 0xD800) {
-            char b[] = {
-                static_cast<char>(0b11100000 | (c >> 12 & 0b1111)),
-                static_cast<char>(0b10000000 | (c >> 6  & 0b111111)),
-                static_cast<char>(0b10000000 | (c       & 0b111111)),
-                0,
-            };
-            buf << b;
-            ++it;
-            continue;
-        }
-
-        {
-            const auto c = fromUtf16(it, end());
-
-            char b[] = {
-                    static_cast<char>(0b11110000 | (c >> 18 & 0b111)),
-                    static_cast<char>(0b10000000 | (c >> 12 & 0b111111)),
-                    static_cast<char>(0b10000000 | (c >> 6 & 0b111111)),
-                    static_cast<char>(0b10000000 | (c & 0b111111)),
-                    0,
-            };
-            buf << b;
-        }
-    }
+    buf.resize(aui::detail::utf::utf8Length(utf16));
+    aui::detail::utf::utf16ToUtf8(utf16, buf.data());
     return buf;
 }
 
@@ -187,10 +93,10 @@ AStringVector AString::split(char16_t c) const noexcept
         return {};
     }
     AStringVector result;
-    result.reserve(length() / 10);
+    result.reserve(aui::detail::search::count(*this, c) + 1);
     for (size_type s = 0;;)
     {
-        auto next = super::find(c, s);
+        auto next = find(c, s);
         if (next == npos)
         {
             result << substr(s);
@@ -203,6 +109,29 @@ AStringVector AString::split(char16_t c) const noexcept
     return result;
 }
 
+AVector<std::u16string_view> AString::splitView(char16_t c) const noexcept
+{
+    if (empty()) {
+        return {};
+    }
+    std::u16string_view view = *this;
+    AVector<std::u16string_view> result;
+    result.reserve(aui::detail::search::count(view, c) + 1);
+    for (size_type s = 0;;)
+    {
+        auto next = aui::detail::search::find(view, c, s);
+        if (next == npos)
+        {
+            result << view.substr(s);
+            break;
+        }
+
+        result << view.substr(s, next - s);
+        s = next + 1;
+    }
+    return result;
+}
+
 AString AString::trimLeft(char16_t symbol) const noexcept
 {
     for (auto i = begin(); i != end(); ++i)
@@ -236,60 +165,43 @@ AString& AString::replaceAll(char16_t from, char16_t to) noexcept {
 }
 
 AString& AString::replaceAll(const AString& from, const AString& to) {
-    for (size_type next = 0;;)
-    {
-        next = find(from, next);
-        if (next == NPOS)
-        {
-            return *this;
-        }
-
-        auto fromLength = from.length();
-        auto toLength = to.length();
-
-        if (fromLength == toLength) {
-            for (auto c : to) {
-                *(begin() + next++) = c;
-            }
-        } else if (fromLength < toLength) {
-            const auto diff = toLength - fromLength;
-            for (auto c : aui::range(to.begin(), to.end() - diff)) {
-                *(begin() + next++) = c;
-            }
-            next = std::distance(begin(), insert(begin() + next, to.begin() + fromLength, to.end())) + 1;
-        } else {
-            for (auto c : to) {
-                *(begin() + next++) = c;
-            }
-            const auto diff = fromLength - toLength;
-            erase(begin() + next, begin() + next + diff);
-        }
+    if (from.empty()) {
+        return *this;
+    }
+    if (from.length() != to.length()) {
+        // shifting the tail on every match is quadratic; build the result at once instead.
+        return *this = replacedAll(from, to);
+    }
+    for (auto next = find(from); next != NPOS; next = find(from, next + from.length())) {
+        std::copy(to.begin(), to.end(), begin() + next);
     }
     return *this;
 }
 
 AString AString::replacedAll(const AString& from, const AString& to) const
 {
-    AString result;
-
-    result.reserve(size());
+    auto matches = aui::detail::search::count(*this, from);
+    if (matches == 0) {
+        return *this;
+    }
 
+    AString result;
+    result.resize(length() - matches * from.length() + matches * to.length());
+    auto dst = result.data();
     for (size_type pos = 0;;)
     {
         auto next = find(from, pos);
         if (next == NPOS)
         {
-            result.insert(result.end(), begin() + pos, end());
+            std::copy(begin() + pos, end(), dst);
             return result;
         }
 
-        result.insert(result.end(), begin() + pos, begin() + next);
-        result.insert(result.end(), to.begin(), to.end());
+        dst = std::copy(begin() + pos, begin() + next, dst);
+        dst = std::copy(to.begin(), to.end(), dst);
 
         pos = next + from.length();
     }
-
-    return result;
 }
 
 AString AString::fromLatin1(const AByteBuffer& buffer)
@@ -337,825 +249,24 @@ AOptional<int> AString::toNumber(aui::ranged_number<int, 2, 36> base) const noex
 
 std::string AString::toStdString() const noexcept
 {
-    auto encoded = toUtf8();
-    std::string dst;
-    dst.reserve(encoded.getSize());
-    dst.insert(0, encoded.data(), encoded.getSize());
-
+    std::u16string_view utf16(data(), size());
+    std::string dst(aui::detail::utf::utf8Length(utf16), '\0');
+    aui::detail::utf::utf16ToUtf8(utf16, dst.data());
     return dst;
 }
 
 AString AString::uppercase() const {
-    std::string buf = toStdString();
-    {
-        auto p = reinterpret_cast<unsigned char *>(buf.data());
-        unsigned char* pExtChar = 0;
-        while (*p) {
-            if ((*p >= 0x61) && (*p <= 0x7a)) // US ASCII
-                (*p) -= 0x20;
-            else if (*p > 0xc0) {
-                pExtChar = p;
-                p++;
-                switch (*pExtChar) {
-                    case 0xc3: // Latin 1
-                        if ((*p >= 0xa0)
-                            && (*p <= 0xbe)
-                            && (*p != 0xb7))
-                            (*p) -= 0x20; // US ASCII shift
-                        break;
-                    case 0xc4: // Latin Exteneded
-                        if ((*p >= 0x80)
-                            && (*p <= 0xb7)
-                            && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0xb9)
-                                 && (*p <= 0xbe)
-                                 && (!(*p % 2))) // Even
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xbf) {
-                            *pExtChar = 0xc5;
-                            (*p) = 0x80;
-                        }
-                        break;
-                    case 0xc5: // Latin Exteneded
-                        if ((*p >= 0x80)
-                            && (*p <= 0x88)
-                            && (!(*p % 2))) // Even
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0x8a)
-                                 && (*p <= 0xb7)
-                                 && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0xb9)
-                                 && (*p <= 0xbe)
-                                 && (!(*p % 2))) // Even
-                            (*p)--; // Prev char is upr
-                        break;
-                    case 0xc6: // Latin Exteneded
-                        switch (*p) {
-                            case 0x83:
-                            case 0x85:
-                            case 0x88:
-                            case 0x8c:
-                            case 0x92:
-                            case 0x99:
-                            case 0xa1:
-                            case 0xa3:
-                            case 0xa5:
-                            case 0xa8:
-                            case 0xad:
-                            case 0xb0:
-                            case 0xb4:
-                            case 0xb6:
-                            case 0xb9:
-                            case 0xbd:
-                                (*p)--; // Prev char is upr
-                                break;
-                            default:
-                                break;
-                        }
-                        break;
-                    case 0xc7: // Latin Exteneded
-                        if (*p == 0x86)
-                            (*p) = 0x84;
-                        else if (*p == 0x85)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0x89)
-                            (*p) = 0x87;
-                        else if (*p == 0x88)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0x8c)
-                            (*p) = 0x8a;
-                        else if (*p == 0x8b)
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0x8d)
-                                 && (*p <= 0x9c)
-                                 && (!(*p % 2))) // Even
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0x9e)
-                                 && (*p <= 0xaf)
-                                 && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xb3)
-                            (*p) = 0xb1;
-                        else if (*p == 0xb2)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xb4)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xb8)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xba)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xbc)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xbe)
-                            (*p)--; // Prev char is upr
-                        break;
-                    case 0xc8: // Latin Exteneded
-                        if ((*p >= 0x80)
-                            && (*p <= 0x9f)
-                            && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0xa2)
-                                 && (*p <= 0xb3)
-                                 && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xbc)
-                            (*p)--; // Prev char is upr
-                        break;
-                    case 0xcd: // Greek & Coptic
-                        switch (*p) {
-                            case 0xb1:
-                            case 0xb3:
-                            case 0xb7:
-                                (*p)--; // Prev char is upr
-                                break;
-                            default:
-                                if (*p == 0xbb) {
-                                    *pExtChar = 0xcf;
-                                    (*p) = 0xbd;
-                                }
-                                else if (*p == 0xbc) {
-                                    *pExtChar = 0xcf;
-                                    (*p) = 0xbe;
-                                }
-                                else if (*p == 0xbd) {
-                                    *pExtChar = 0xcf;
-                                    (*p) = 0xbf;
-                                }
-                                break;
-                        }
-                        break;
-                    case 0xce: // Greek & Coptic
-                        if (*p == 0xac)
-                            (*p) = 0x86;
-                        else if (*p == 0xad)
-                            (*p) = 0x88;
-                        else if (*p == 0xae)
-                            (*p) = 0x89;
-                        else if (*p == 0xaf)
-                            (*p) = 0x8a;
-                        else if ((*p >= 0xb1)
-                                 && (*p <= 0xbf))
-                            (*p) -= 0x20; // US ASCII shift
-                        break;
-                    case 0xcf: // Greek & Coptic
-                        if (*p == 0xb4)
-                            (*p) = 0x8f;
-                        else if (*p == 0x92)
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0x98)
-                                 && (*p <= 0xaf)
-                                 && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0x91)
-                            (*p) = 0xb4;
-                        else if (*p == 0xb8)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0xb2)
-                            (*p) = 0xb9;
-                        else if (*p == 0xbc)
-                            (*p)--; // Prev char is upr
-                        else if (*p == 0x8c) {
-                            *pExtChar = 0xce;
-                            (*p) = 0x8c;
-                        }
-                        else if (*p == 0x8d) {
-                            *pExtChar = 0xce;
-                            (*p) = 0x8e;
-                        }
-                        else if (*p == 0x8e) {
-                            *pExtChar = 0xce;
-                            (*p) = 0x8f;
-                        }
-                        else if ((*p >= 0x80)
-                                 && (*p <= 0x8b)
-                                 && (*p != 0x82)) {
-                            *pExtChar = 0xce;
-                            (*p) += 0x20;
-                        }
-                        else if (*p == 0xb3) {
-                            *pExtChar = 0xcd;
-                            (*p) = 0xbf;
-                        }
-                        break;
-                    case 0xd0: // Cyrillic
-                        if ((*p >= 0xb0)
-                            && (*p <= 0xbf))
-                            (*p) -= 0x20; // US ASCII shift
-                        break;
-                    case 0xd1: // Cyrillic supplement
-                        if ((*p >= 0x90)
-                            && (*p <= 0x9f)) {
-                            *pExtChar = 0xd0;
-                            (*p) -= 0x10;
-                        }
-                        else if ((*p >= 0x80)
-                                 && (*p <= 0x8f)) {
-                            *pExtChar = 0xd0;
-                            (*p) += 0x20;
-                        }
-                        else if ((*p >= 0xa0)
-                                 && (*p <= 0xbf)
-                                 && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        break;
-                    case 0xd2: // Cyrillic supplement
-                        if (*p == 0x80)
-                            (*p)++; // Prev char is upr
-                        else if ((*p >= 0x8a)
-                                 && (*p <= 0xbf)
-                                 && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        break;
-                    case 0xd3: // Cyrillic supplement
-                        if ((*p >= 0x81)
-                            && (*p <= 0x8e)
-                            && (!(*p % 2))) // Even
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0x90)
-                                 && (*p <= 0xbf)
-                                 && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        break;
-                    case 0xd4: // Cyrillic supplement & Armenian
-                        if ((*p >= 0x80)
-                            && (*p <= 0xaf)
-                            && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        break;
-                    case 0xd5: // Armenian
-                        if ((*p >= 0x80)
-                            && (*p <= 0x96)
-                            && (*p % 2)) // Odd
-                            (*p)--; // Prev char is upr
-                        else if ((*p >= 0xa1)
-                                 && (*p <= 0xaf)) {
-                            *pExtChar = 0xd4;
-                            (*p) += 0x10;
-                        }
-                        break;
-                    case 0xe1: // Three byte code
-                        pExtChar = p;
-                        p++;
-                        switch (*pExtChar) {
-                            case 0x82: // Georgian
-                                break;
-                            case 0x83: // Georgian
-                                if ((*p >= 0x90)
-                                    && (*p <= 0xaf)) {
-                                    *pExtChar = 0x82;
-                                    (*p) += 0x10;
-                                }
-                                else if (((*p >= 0xb0)
-                                         && ((*p <= 0xb5)
-                                             || (*p == 0xb7)))
-                                         || (*p == 0xbd))
-                                    (*p) -= 0x30;
-                                break;
-                            case 0xb8: // Latin extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0xbf)
-                                    && (*p % 2)) // Odd
-                                    (*p)--; // Prev char is upr
-                                break;
-                            case 0xb9: // Latin extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0xbf)
-                                    && (*p % 2)) // Odd
-                                    (*p)--; // Prev char is upr
-                                break;
-                            case 0xba: // Latin extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0x94)
-                                    && (*p % 2)) // Odd
-                                    (*p)--; // Prev char is upr
-                                else if ((*p >= 0x9e)
-                                         && (*p <= 0xbf)
-                                         && (*p % 2)) // Odd
-                                    (*p)--; // Prev char is upr
-                                break;
-                            case 0xbb: // Latin extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0xbf)
-                                    && (*p % 2)) // Odd
-                                    (*p)--; // Prev char is upr
-                                break;
-                            case 0xbc: // Greek extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0x87))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0x90)
-                                         && (*p <= 0x97))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0xa0)
-                                         && (*p <= 0xa7))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0xb0)
-                                         && (*p <= 0x87))
-                                    (*p) += 0x08;
-                                break;
-                            case 0xbd: // Greek extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0x87))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0x90)
-                                         && (*p <= 0x97))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0xa0)
-                                         && (*p <= 0xa7))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0xb0)
-                                         && (*p <= 0x87))
-                                    (*p) += 0x08;
-                                break;
-                            case 0xbe: // Greek extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0x87))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0x90)
-                                         && (*p <= 0x97))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0xa0)
-                                         && (*p <= 0xa7))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0xb0)
-                                         && (*p <= 0xb1))
-                                    (*p) += 0x08;
-                                break;
-                            case 0xbf: // Greek extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0x84))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0x90)
-                                         && (*p <= 0x93))
-                                    (*p) += 0x08;
-                                else if ((*p >= 0xa0)
-                                         && (*p <= 0xa4))
-                                    (*p) += 0x08;
-                                break;
-                            default:
-                                break;
-                        }
-                        break;
-                    case 0xf0: // Four byte code
-                        pExtChar = p;
-                        p++;
-                        switch (*pExtChar) {
-                            case 0x90:
-                                pExtChar = p;
-                                p++;
-                                switch (*pExtChar) {
-                                    case 0x92: // Osage
-                                        break;
-                                    case 0x93: // Osage
-                                        if ((*p >= 0x80)
-                                            && (*p <= 0x93))
-                                            (*p) += 0x18;
-                                        else if ((*p >= 0x98)
-                                                 && (*p <= 0xa7)) {
-                                            *pExtChar = 0x92;
-                                            (*p) += 0x18;
-                                        }
-                                        break;
-                                    default:
-                                        break;
-                                }
-                                break;
-                            case 0x9E:
-                                pExtChar = p;
-                                p++;
-                                switch (*pExtChar) {
-                                    case 0xA4: // Adlam
-                                        if ((*p >= 0xa2)
-                                            && (*p <= 0xc3))
-                                            (*p) -= 0x22;
-                                        break;
-                                    default:
-                                        break;
-                                }
-                                break;
-                            default:
-                                break;
-                        }
-                        break;
-                    default:
-                        break;
-                }
-                pExtChar = 0;
-            }
-            p++;
-        }
-    }
-
-    return buf;
+    AString result;
+    result.resize(length());
+    aui::detail::casemap::toUpper(*this, result.data());
+    return result;
 }
 
 AString AString::lowercase() const {
-    std::string buf = toStdString();
-    {
-        auto p = reinterpret_cast<unsigned char *>(buf.data());
-        unsigned char* pExtChar = 0;
-        while (*p) {
-            if ((*p >= 0x41) && (*p <= 0x5a)) // US ASCII
-                (*p) += 0x20;
-            else if (*p > 0xc0) {
-                pExtChar = p;
-                p++;
-                switch (*pExtChar) {
-                    case 0xc3: // Latin 1
-                        if ((*p >= 0x80)
-                            && (*p <= 0x9e)
-                            && (*p != 0x97))
-                            (*p) += 0x20; // US ASCII shift
-                        break;
-                    case 0xc4: // Latin Exteneded
-                        if ((*p >= 0x80)
-                            && (*p <= 0xb7)
-                            && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0xb9)
-                                 && (*p <= 0xbe)
-                                 && (*p % 2)) // Odd
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xbf) {
-                            *pExtChar = 0xc5;
-                            (*p) = 0x80;
-                        }
-                        break;
-                    case 0xc5: // Latin Exteneded
-                        if ((*p >= 0x80)
-                            && (*p <= 0x88)
-                            && (*p % 2)) // Odd
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0x8a)
-                                 && (*p <= 0xb7)
-                                 && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0xb9)
-                                 && (*p <= 0xbe)
-                                 && (*p % 2)) // Odd
-                            (*p)++; // Next char is lwr
-                        break;
-                    case 0xc6: // Latin Exteneded
-                        switch (*p) {
-                            case 0x82:
-                            case 0x84:
-                            case 0x87:
-                            case 0x8b:
-                            case 0x91:
-                            case 0x98:
-                            case 0xa0:
-                            case 0xa2:
-                            case 0xa4:
-                            case 0xa7:
-                            case 0xac:
-                            case 0xaf:
-                            case 0xb3:
-                            case 0xb5:
-                            case 0xb8:
-                            case 0xbc:
-                                (*p)++; // Next char is lwr
-                                break;
-                            default:
-                                break;
-                        }
-                        break;
-                    case 0xc7: // Latin Exteneded
-                        if (*p == 0x84)
-                            (*p) = 0x86;
-                        else if (*p == 0x85)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0x87)
-                            (*p) = 0x89;
-                        else if (*p == 0x88)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0x8a)
-                            (*p) = 0x8c;
-                        else if (*p == 0x8b)
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0x8d)
-                                 && (*p <= 0x9c)
-                                 && (*p % 2)) // Odd
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0x9e)
-                                 && (*p <= 0xaf)
-                                 && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xb1)
-                            (*p) = 0xb3;
-                        else if (*p == 0xb2)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xb4)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xb8)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xba)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xbc)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xbe)
-                            (*p)++; // Next char is lwr
-                        break;
-                    case 0xc8: // Latin Exteneded
-                        if ((*p >= 0x80)
-                            && (*p <= 0x9f)
-                            && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0xa2)
-                                 && (*p <= 0xb3)
-                                 && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xbb)
-                            (*p)++; // Next char is lwr
-                        break;
-                    case 0xcd: // Greek & Coptic
-                        switch (*p) {
-                            case 0xb0:
-                            case 0xb2:
-                            case 0xb6:
-                                (*p)++; // Next char is lwr
-                                break;
-                            default:
-                                if (*p == 0xbf) {
-                                    *pExtChar = 0xcf;
-                                    (*p) = 0xb3;
-                                }
-                                break;
-                        }
-                        break;
-                    case 0xce: // Greek & Coptic
-                        if (*p == 0x86)
-                            (*p) = 0xac;
-                        else if (*p == 0x88)
-                            (*p) = 0xad;
-                        else if (*p == 0x89)
-                            (*p) = 0xae;
-                        else if (*p == 0x8a)
-                            (*p) = 0xaf;
-                        else if (*p == 0x8c) {
-                            *pExtChar = 0xcf;
-                            (*p) = 0x8c;
-                        }
-                        else if (*p == 0x8e) {
-                            *pExtChar = 0xcf;
-                            (*p) = 0x8d;
-                        }
-                        else if (*p == 0x8f) {
-                            *pExtChar = 0xcf;
-                            (*p) = 0x8e;
-                        }
-                        else if ((*p >= 0x91)
-                                 && (*p <= 0x9f))
-                            (*p) += 0x20; // US ASCII shift
-                        else if ((*p >= 0xa0)
-                                 && (*p <= 0xab)
-                                 && (*p != 0xa2)) {
-                            *pExtChar = 0xcf;
-                            (*p) -= 0x20;
-                        }
-                        break;
-                    case 0xcf: // Greek & Coptic
-                        if (*p == 0x8f)
-                            (*p) = 0xb4;
-                        else if (*p == 0x91)
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0x98)
-                                 && (*p <= 0xaf)
-                                 && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xb4)
-                            (*p) = 0x91;
-                        else if (*p == 0xb7)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xb9)
-                            (*p) = 0xb2;
-                        else if (*p == 0xbb)
-                            (*p)++; // Next char is lwr
-                        else if (*p == 0xbd) {
-                            *pExtChar = 0xcd;
-                            (*p) = 0xbb;
-                        }
-                        else if (*p == 0xbe) {
-                            *pExtChar = 0xcd;
-                            (*p) = 0xbc;
-                        }
-                        else if (*p == 0xbf) {
-                            *pExtChar = 0xcd;
-                            (*p) = 0xbd;
-                        }
-
-                        break;
-                    case 0xd0: // Cyrillic
-                        if ((*p >= 0x80)
-                            && (*p <= 0x8f)) {
-                            *pExtChar = 0xd1;
-                            (*p) += 0x10;
-                        }
-                        else if ((*p >= 0x90)
-                                 && (*p <= 0x9f))
-                            (*p) += 0x20; // US ASCII shift
-                        else if ((*p >= 0xa0)
-                                 && (*p <= 0xaf)) {
-                            *pExtChar = 0xd1;
-                            (*p) -= 0x20;
-                        }
-                        break;
-                    case 0xd1: // Cyrillic supplement
-                        if ((*p >= 0xa0)
-                            && (*p <= 0xbf)
-                            && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        break;
-                    case 0xd2: // Cyrillic supplement
-                        if (*p == 0x80)
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0x8a)
-                                 && (*p <= 0xbf)
-                                 && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        break;
-                    case 0xd3: // Cyrillic supplement
-                        if ((*p >= 0x81)
-                            && (*p <= 0x8e)
-                            && (*p % 2)) // Odd
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0x90)
-                                 && (*p <= 0xbf)
-                                 && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        break;
-                    case 0xd4: // Cyrillic supplement & Armenian
-                        if ((*p >= 0x80)
-                            && (*p <= 0xaf)
-                            && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        else if ((*p >= 0xb1)
-                                 && (*p <= 0xbf)) {
-                            *pExtChar = 0xd5;
-                            (*p) -= 0x10;
-                        }
-                        break;
-                    case 0xd5: // Armenian
-                        if ((*p >= 0x80)
-                            && (*p <= 0x96)
-                            && (!(*p % 2))) // Even
-                            (*p)++; // Next char is lwr
-                        break;
-                    case 0xe1: // Three byte code
-                        pExtChar = p;
-                        p++;
-                        switch (*pExtChar) {
-                            case 0x82: // Georgian
-                                if ((*p >= 0xa0)
-                                    && (*p <= 0xbf)) {
-                                    *pExtChar = 0x83;
-                                    (*p) -= 0x10;
-                                }
-                                break;
-                            case 0x83: // Georgian
-                                if (((*p >= 0x80)
-                                    && ((*p <= 0x85)
-                                        || (*p == 0x87)))
-                                    || (*p == 0x8d))
-                                    (*p) += 0x30;
-                                break;
-                            case 0xb8: // Latin extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0xbf)
-                                    && (!(*p % 2))) // Even
-                                    (*p)++; // Next char is lwr
-                                break;
-                            case 0xb9: // Latin extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0xbf)
-                                    && (!(*p % 2))) // Even
-                                    (*p)++; // Next char is lwr
-                                break;
-                            case 0xba: // Latin extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0x94)
-                                    && (!(*p % 2))) // Even
-                                    (*p)++; // Next char is lwr
-                                else if ((*p >= 0x9e)
-                                         && (*p <= 0xbf)
-                                         && (!(*p % 2))) // Even
-                                    (*p)++; // Next char is lwr
-                                break;
-                            case 0xbb: // Latin extened
-                                if ((*p >= 0x80)
-                                    && (*p <= 0xbf)
-                                    && (!(*p % 2))) // Even
-                                    (*p)++; // Next char is lwr
-                                break;
-                            case 0xbc: // Greek extened
-                                if ((*p >= 0x88)
-                                    && (*p <= 0x8f))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0x98)
-                                         && (*p <= 0x9f))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0xa8)
-                                         && (*p <= 0xaf))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0xb8)
-                                         && (*p <= 0x8f))
-                                    (*p) -= 0x08;
-                                break;
-                            case 0xbd: // Greek extened
-                                if ((*p >= 0x88)
-                                    && (*p <= 0x8d))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0x98)
-                                         && (*p <= 0x9f))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0xa8)
-                                         && (*p <= 0xaf))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0xb8)
-                                         && (*p <= 0x8f))
-                                    (*p) -= 0x08;
-                                break;
-                            case 0xbe: // Greek extened
-                                if ((*p >= 0x88)
-                                    && (*p <= 0x8f))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0x98)
-                                         && (*p <= 0x9f))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0xa8)
-                                         && (*p <= 0xaf))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0xb8)
-                                         && (*p <= 0xb9))
-                                    (*p) -= 0x08;
-                                break;
-                            case 0xbf: // Greek extened
-                                if ((*p >= 0x88)
-                                    && (*p <= 0x8c))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0x98)
-                                         && (*p <= 0x9b))
-                                    (*p) -= 0x08;
-                                else if ((*p >= 0xa8)
-                                         && (*p <= 0xac))
-                                    (*p) -= 0x08;
-                                break;
-                            default:
-                                break;
-                        }
-                        break;
-                    case 0xf0: // Four byte code
-                        pExtChar = p;
-                        p++;
-                        switch (*pExtChar) {
-                            case 0x90:
-                                pExtChar = p;
-                                p++;
-                                switch (*pExtChar) {
-                                    case 0x92: // Osage
-                                        if ((*p >= 0xb0)
-                                            && (*p <= 0xbf)) {
-                                            *pExtChar = 0x93;
-                                            (*p) -= 0x18;
-                                        }
-                                        break;
-                                    case 0x93: // Osage
-                                        if ((*p >= 0x80)
-                                            && (*p <= 0x93))
-                                            (*p) += 0x18;
-                                        break;
-                                    default:
-                                        break;
-                                }
-                                break;
-                            default:
-                                break;
-                        }
-                        break;
-                    case 0x9E:
-                        pExtChar = p;
-                        p++;
-                        switch (*pExtChar) {
-                            case 0xA4: // Adlam
-                                if ((*p >= 0x80)
-                                    && (*p <= 0xA1))
-                                    (*p) += 0x22;
-                                break;
-                            default:
-                                break;
-                        }
-                        break;
-                    default:
-                        break;
-                }
-                pExtChar = 0;
-            }
-            p++;
-        }
-    }
-
-    return buf;
+    AString result;
+    result.resize(length());
+    aui::detail::casemap::toLower(*this, result.data());
+    return result;
 }
 
 void AString::resizeToNullTerminator() {
@@ -1172,9 +283,8 @@ AString AString::restrictLength(size_t s, const AString& stringAtEnd) const {
 }
 
 AString AString::numberHex(int i) noexcept {
-    char buf[32];
-    sprintf(buf, "%x", i);
-    return buf;
+    char16_t buffer[aui::detail::number::MAX_INTEGER_LENGTH_ANY_BASE];
+    return AString(buffer, aui::detail::number::toChars(buffer, unsigned(i), 16));
 }
 
 AString AString::processEscapes() const {
@@ -1223,82 +333,30 @@ AString AString::excessSpacesRemoved() const noexcept {
 
 template<typename T>
 AOptional<T> AString::toNumberImpl() const noexcept {
-    if (empty()) return std::nullopt;
-    T value = 0;
-    T prevValue = 0;
-    bool negative = false;
-
+    const auto* first = data();
+    const auto* last = first + size();
+    T value{};
+    aui::detail::number::FromCharsResult result{};
     if constexpr (std::is_integral_v<T>) {
-        if (startsWith("0x") || startsWith("0X")) {
-            // hex
-            for (auto c : substr(2)) {
-                value *= 16;
-                if (value < prevValue) { // overflow check
-                    return std::nullopt;
-                }
-                prevValue = value;
-                if (c >= '0' && c <= '9') {
-                    value += c - '0';
-                } else if (c >= 'a' && c <= 'f') {
-                    value += (c - 'a') + 10;
-                } else if (c >= 'A' && c <= 'F') {
-                    value += (c - 'A') + 10;
-                } else {
-                    return std::nullopt;
-                }
+        if (size() >= 2 && first[0] == u'0' && (first[1] == u'x' || first[1] == u'X')) {
+            first += 2;
+            if (first == last) {
+                return T(0);
             }
-        } else {
-            auto i = begin();
-            if (*i == '-') {
-                negative = true;
-                ++i;
-            }
-            for (; i != end(); ++i) {
-                value *= 10;
-                if (value < prevValue) { // overflow check
-                    return std::nullopt;
-                }
-                prevValue = value;
-                auto c = *i;
-                if (c >= '0' && c <= '9') {
-                    value += c - '0';
-                } else {
-                    return std::nullopt;
-                }
-            }
-        }
-    } else if constexpr (std::is_floating_point_v<T>) {
-        bool fractionalPart = false;
-        double fractionalPower = 0.1;
-
-        auto i = begin();
-        if (*i == '-') {
-            negative = true;
-            ++i;
-        }
-        for (; i != end(); ++i) {
-            auto c = *i;
-            if (c >= '0' && c <= '9') {
-                T digitValue = c - '0';
-                if (fractionalPart) {
-                    value += digitValue * fractionalPower;
-                    fractionalPower *= 0.1;
-                } else {
-                    value *= 10;
-                    value += digitValue;
-                }
-            } else if (c == '.') {
-                if (fractionalPart) {
-                    return std::nullopt;
-                }
-                fractionalPart = true;
-            } else {
+            if (*first == u'-') {
                 return std::nullopt;
             }
+            result = aui::detail::number::fromChars(first, last, value, 16);
+        } else {
+            result = aui::detail::number::fromChars(first, last, value);
         }
+    } else {
+        result = aui::detail::number::fromChars(first, last, value);
     }
-
-    return negative ? -value : value;
+    if (result.ec != std::errc{} || result.ptr != last) {
+        return std::nullopt;
+    }
+    return value;
 }
 
 AOptional<int> AString::toInt() const noexcept {
@@ -17,8 +17,12 @@
 #include "AUI/Core.h"
 #include "AUI/Traits/values.h"
 #include <AUI/Common/ASet.h>
+#include <AUI/Common/AContainerPrototypes.h>
 #include <optional>
 #include <AUI/Common/AOptional.h>
+#include <AUI/Common/detail/casemap.h>
+#include <AUI/Common/detail/number.h>
+#include <AUI/Common/detail/search.h>
 #include <fmt/core.h>
 
 class API_AUI_CORE AStringVector;
@@ -172,9 +176,72 @@ public:
         super::pop_back();
     }
 
+    /**
+     * @brief Maps the string to uppercase according to the simple Unicode case mapping.
+     * @details
+     * The result has the same length as the string. Mappings to several characters (i.e., German ß to SS) and locale
+     * specific mappings are not applied.
+     */
     AString uppercase() const;
+
+    /**
+     * @brief Maps the string to lowercase according to the simple Unicode case mapping.
+     * @details
+     * The result has the same length as the string. Locale specific mappings are not applied.
+     */
     AString lowercase() const;
 
+    /**
+     * @brief Case-insensitive equality.
+     * @details
+     * Compares simple Unicode case folds of the strings without allocating, i.e., faster than
+     * <code>a.lowercase() == b.lowercase()</code>.
+     */
+    bool equalsIgnoreCase(const AString& other) const noexcept
+    {
+        return aui::detail::casemap::equalsIgnoreCase(*this, other);
+    }
+
+    /**
+     * @brief Case-insensitive three-way comparison.
+     * @return negative value if the string is less than other, zero if they are equal ignoring case, positive value
+     *         otherwise. The strings are ordered by code points of their simple Unicode case folds.
+     */
+    int compareIgnoreCase(const AString& other) const noexcept
+    {
+        return aui::detail::casemap::compareIgnoreCase(*this, other);
+    }
+
+    /**
+     * @return hash of the string consistent with equalsIgnoreCase.
+     */
+    std::size_t hashIgnoreCase() const noexcept
+    {
+        return aui::detail::casemap::hashIgnoreCase(*this);
+    }
+
+    /**
+     * @brief Case-insensitive hasher for hash containers.
+     * @details
+     * @code{cpp}
+     * AUnorderedMap<AString, int, AString::HashIgnoreCase, AString::EqualIgnoreCase> map;
+     * @endcode
+     */
+    struct HashIgnoreCase {
+        std::size_t operator()(const AString& string) const noexcept {
+            return string.hashIgnoreCase();
+        }
+    };
+
+    /**
+     * @brief Case-insensitive equality predicate for hash containers.
+     */
+    struct EqualIgnoreCase {
+        bool operator()(const AString& lhs, const AString& rhs) const noexcept {
+            return lhs.equalsIgnoreCase(rhs);
+        }
+    };
+
     bool startsWith(const AString& other) const noexcept
     {
         return rfind(other, 0) == 0;
@@ -190,7 +257,7 @@ public:
             return false;
         }
         size_t offset = length() - other.length();
-        return super::find(other, offset) == offset;
+        return find(other, offset) == offset;
     }
     bool endsWith(char16_t c) const noexcept
     {
@@ -200,17 +267,25 @@ public:
 
     AStringVector split(char16_t c) const noexcept;
 
+    /**
+     * @brief Splits the string by the separator without copying the parts.
+     * @details
+     * Same as split, but the parts refer to the string's contents, so they are invalidated by modification or
+     * destruction of the string.
+     */
+    AVector<std::u16string_view> splitView(char16_t c) const noexcept;
+
     size_type find(char c, size_type offset = 0) const noexcept
     {
-        return super::find(c, offset);
+        return aui::detail::search::find(*this, char16_t(c), offset);
     }
     size_type find(char16_t c, size_type offset = 0) const noexcept
     {
-        return super::find(c, offset);
+        return aui::detail::search::find(*this, c, offset);
     }
     size_type find(const AString& str, size_type offset = 0) const noexcept
     {
-        return super::find(str, offset);
+        return aui::detail::search::find(*this, str, offset);
     }
     size_type rfind(char c, size_type offset = NPOS) const noexcept
     {
@@ -244,6 +319,14 @@ public:
     {
         super::resize(s);
     }
+    size_type capacity() const noexcept
+    {
+        return super::capacity();
+    }
+    void shrink_to_fit()
+    {
+        super::shrink_to_fit();
+    }
 
     AString restrictLength(size_t s, const AString& stringAtEnd = "...") const;
 
@@ -417,21 +500,36 @@ public:
 
     static AString numberHex(int i) noexcept;
 
+    /**
+     * @brief Formats the number.
+     * @details
+     * Integers are formatted in base 10, floating point numbers in fixed notation with at most 6 digits after the
+     * point, trailing zeros stripped; bool is formatted as "true" or "false".
+     */
     template<typename T, std::enable_if_t<std::is_integral_v<std::decay_t<T>> || std::is_floating_point_v<std::decay_t<T>>, int> = 0>
     static AString number(T i) noexcept {
+        AString result;
+        result.appendNumber(i);
+        return result;
+    }
+
+    /**
+     * @brief Appends the number formatted as by AString::number.
+     * @details
+     * Unlike <code>str += AString::number(i)</code>, does not create a temporary string.
+     */
+    template<typename T, std::enable_if_t<std::is_integral_v<std::decay_t<T>> || std::is_floating_point_v<std::decay_t<T>>, int> = 0>
+    AString& appendNumber(T i) noexcept {
         if constexpr (std::is_same_v<bool, std::decay_t<T>>) {
-            if (i)
-                return "true";
-            return "false";
+            super::append(i ? u"true" : u"false");
+        } else if constexpr (std::is_integral_v<std::decay_t<T>>) {
+            char16_t buffer[aui::detail::number::MAX_INTEGER_LENGTH];
+            super::append(buffer, aui::detail::number::toChars(buffer, i));
         } else {
-            auto v = std::to_string(i);
-            if constexpr (std::is_floating_point_v<T>) {
-                // remove trailing zeros
-                v.erase(v.find_last_not_of('0') + 1, std::u16string::npos);
-                v.erase(v.find_last_not_of('.') + 1, std::u16string::npos);
-            }
-            return v;
+            char16_t buffer[aui::detail::number::MAX_FLOATING_LENGTH];
+            super::append(buffer, aui::detail::number::toChars(buffer, double(i)));
         }
+        return *this;
     }
 
     static constexpr auto TO_NUMBER_BASE_BIN = 2;
@@ -527,10 +625,14 @@ public:
     }
     inline ::AString& operator+=(const char* str) noexcept
     {
-        *this += AString(str);
-        return *this;
+        return appendUtf8(str);
     }
 
+    /**
+     * @brief Decodes UTF-8 and appends the result, without a temporary string.
+     */
+    AString& appendUtf8(std::string_view utf8) noexcept;
+
     [[nodiscard]] bool empty() const noexcept {
         return super::empty();
     }
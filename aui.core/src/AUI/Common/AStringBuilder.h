@@ -0,0 +1,159 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <fmt/format.h>
+#include "AUI/Common/AString.h"
+
+/**
+ * @brief Builds a string from pieces in a single buffer.
+ * @ingroup core
+ * @details
+ * Each step of an <code>operator+</code> chain creates a temporary string and copies everything collected so far.
+ * AStringBuilder appends to a single buffer instead:
+ *
+ * @code{cpp}
+ * AStringBuilder message;
+ * message << "unexpected token " << token << " at " << row << ":" << column;
+ * throw AJsonParseException(std::move(message).build());
+ * @endcode
+ *
+ * When all pieces are known at once, concat measures them first and allocates once:
+ *
+ * @code{cpp}
+ * throw AJsonParseException(AStringBuilder::concat("unexpected token ", token, " at ", row, ":", column));
+ * @endcode
+ *
+ * Accepted pieces are:
+ * - AString and types convertible to it (AAtom, APath);
+ * - UTF-16 strings: const char16_t*, std::u16string, std::u16string_view;
+ * - UTF-8 strings: const char*, std::string, std::string_view, AUtf8String;
+ * - char and char16_t, appended as a character;
+ * - numbers and bool, formatted as by AString::number.
+ */
+class AStringBuilder {
+public:
+    AStringBuilder() = default;
+
+    explicit AStringBuilder(std::size_t capacity) {
+        mBuffer.reserve(capacity);
+    }
+
+    template<typename T>
+    AStringBuilder& operator<<(const T& piece) {
+        append(piece);
+        return *this;
+    }
+
+    /**
+     * @brief Appends fmt formatted string.
+     * @details
+     * @code{cpp}
+     * builder.format("{}x{} px", width, height);
+     * @endcode
+     */
+    template<typename... Args>
+    AStringBuilder& format(fmt::format_string<Args...> format, Args&&... args) {
+        fmt::memory_buffer utf8;
+        fmt::format_to(std::back_inserter(utf8), format, std::forward<Args>(args)...);
+        mBuffer.appendUtf8({ utf8.data(), utf8.size() });
+        return *this;
+    }
+
+    void reserve(std::size_t capacity) {
+        mBuffer.reserve(capacity);
+    }
+
+    [[nodiscard]]
+    std::size_t length() const noexcept {
+        return mBuffer.length();
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return mBuffer.empty();
+    }
+
+    [[nodiscard]]
+    const AString& str() const noexcept {
+        return mBuffer;
+    }
+
+    /**
+     * @brief Moves the built string out of the builder.
+     */
+    [[nodiscard]]
+    AString build() && noexcept {
+        return std::move(mBuffer);
+    }
+
+    /**
+     * @brief Concatenates the pieces with a single allocation.
+     */
+    template<typename... Pieces>
+    [[nodiscard]]
+    static AString concat(const Pieces&... pieces) {
+        AStringBuilder builder((std::size_t(0) + ... + measure(pieces)));
+        (builder.append(pieces), ...);
+        return std::move(builder).build();
+    }
+
+private:
+    AString mBuffer;
+
+    /**
+     * @brief Typical length of a formatted floating point number; the exact one is not known before formatting.
+     */
+    static constexpr std::size_t FLOATING_LENGTH_HINT = 24;
+
+    /**
+     * @return count of code units piece appends, or an upper bound of it.
+     */
+    template<typename T>
+    static std::size_t measure(const T& piece) noexcept {
+        if constexpr (std::is_same_v<T, char> || std::is_same_v<T, char16_t>) {
+            return 1;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            return FLOATING_LENGTH_HINT;
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            return aui::detail::number::MAX_INTEGER_LENGTH;
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            // a byte never decodes to more than one code unit.
+            return std::string_view(piece).size();
+        } else if constexpr (std::is_convertible_v<const T&, std::u16string_view>) {
+            return std::u16string_view(piece).size();
+        } else {
+            return static_cast<const AString&>(piece).length();
+        }
+    }
+
+    template<typename T>
+    void append(const T& piece) {
+        if constexpr (std::is_same_v<T, char> || std::is_same_v<T, char16_t>) {
+            mBuffer << piece;
+        } else if constexpr (std::is_arithmetic_v<T>) {
+            mBuffer.appendNumber(piece);
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            mBuffer.appendUtf8(piece);
+        } else if constexpr (std::is_convertible_v<const T&, std::u16string_view>) {
+            std::u16string_view view(piece);
+            mBuffer.insert(mBuffer.end(), view.begin(), view.end());
+        } else {
+            mBuffer += static_cast<const AString&>(piece);
+        }
+    }
+};
@@ -18,9 +18,21 @@ AStringVector& AStringVector::noEmptyStrings()
 	return *this;
 }
 
+std::size_t AStringVector::joinedLength(std::size_t separatorLength) const noexcept {
+    if (empty()) {
+        return 0;
+    }
+    std::size_t result = separatorLength * (size() - 1);
+    for (const auto& x : *this) {
+        result += x.length();
+    }
+    return result;
+}
+
 AString AStringVector::join(wchar_t w) const
 {
 	AString res;
+	res.reserve(joinedLength(1));
 
 	for (const auto& x : *this)
 	{
@@ -36,6 +48,7 @@ AString AStringVector::join(wchar_t w) const
 
 AString AStringVector::join(const AString& w) const {
     AString res;
+    res.reserve(joinedLength(w.length()));
 
     for (const auto& x : *this)
     {
@@ -58,4 +58,9 @@ public:
 	[[nodiscard]] AString join(wchar_t w) const;
 	[[nodiscard]] AString join(const AString& w) const;
 
+private:
+	/**
+	 * @return length of the join result, so it's allocated once.
+	 */
+	std::size_t joinedLength(std::size_t separatorLength) const noexcept;
 };
@@ -9,12 +9,24 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <bit>
 #include <AUI/Util/ACleanup.h>
 #include "AUI/Util/AScheduler.h"
 #include "ATimer.h"
 
+namespace {
+    std::chrono::milliseconds defaultSlack(std::chrono::milliseconds period) {
+        // ~5% of the period; powers of two keep slack grids of different timers aligned with each other.
+        if (period.count() < 20) {
+            return std::chrono::milliseconds(0);
+        }
+        return std::chrono::milliseconds(std::bit_floor(static_cast<std::uint64_t>(period.count() / 20)));
+    }
+}
+
 ATimer::ATimer(std::chrono::milliseconds period):
-	mPeriod(period)
+	mPeriod(period),
+	mSlack(defaultSlack(period))
 {
     AUI_ASSERTX(period.count() != 0, "zero period?");
 }
@@ -39,7 +51,7 @@ void ATimer::start()
                 // this is valid
                 emit fired;
             }
-        });
+        }, mSlack);
     }
 }
 
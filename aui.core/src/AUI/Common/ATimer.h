@@ -17,10 +17,15 @@
 /**
  * @brief Async timer.
  * @ingroup core
+ * @details
+ * The timer may fire a bit later than requested (but never earlier) so the timer thread can serve timers with nearby
+ * deadlines in a single wakeup, which saves CPU and power when many timers are running (i.e., a dashboard of widgets
+ * refreshing themselves). See setSlack().
  */
 class API_AUI_CORE ATimer : public AObject {
 private:
     std::chrono::milliseconds mPeriod;
+    std::chrono::milliseconds mSlack;
 
     AOptional<AScheduler::TimerHandle> mTimer;
 
@@ -32,6 +37,24 @@ public:
 
     void restart();
 
+    /**
+     * @brief Sets max delay of the timer's shots used to coalesce it with other timers.
+     * @details
+     * By default, the slack is about 5% of the period rounded down to a power of two milliseconds, so the slacks of
+     * different timers are multiples of each other. Timers with periods shorter than 20ms are exact by default. Pass
+     * 0ms to make the timer exact.
+     *
+     * Takes effect on the next start().
+     */
+    void setSlack(std::chrono::milliseconds slack) noexcept {
+        mSlack = slack;
+    }
+
+    [[nodiscard]]
+    std::chrono::milliseconds slack() const noexcept {
+        return mSlack;
+    }
+
     void start();
     void stop();
     bool isStarted();
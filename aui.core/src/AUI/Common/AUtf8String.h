@@ -0,0 +1,73 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include "AUI/Common/AString.h"
+
+/**
+ * @brief UTF-8 encoded string.
+ * @ingroup core
+ * @details
+ * AString stores UTF-16 code units, while files, JSON, network protocols, databases and syscalls speak UTF-8. A value
+ * that only travels from one of those to another does not need to be decoded to AString and encoded back; keep it in
+ * AUtf8String instead.
+ *
+ * AUtf8String is a std::string, so any API accepting std::string or std::string_view accepts it as is, including
+ * ATokenizer, AJson::fromString, AStringStream and ALogger. Conversion to UTF-16 happens only when it's explicitly
+ * requested by toAString() or by passing the string where AString is expected:
+ *
+ * @code{cpp}
+ * AUtf8String config = readConfig();
+ * auto json = AJson::fromString(config);   // no transcoding
+ * ALogger::info("Config") << config;       // no transcoding
+ * label->setText(config.toAString());      // transcoded once
+ * @endcode
+ */
+class AUtf8String: public std::string {
+public:
+    using std::string::string;
+    using std::string::operator=;
+
+    AUtf8String() noexcept = default;
+
+    AUtf8String(std::string utf8) noexcept: std::string(std::move(utf8)) {}
+
+    /**
+     * @brief Encodes UTF-16 string.
+     */
+    explicit AUtf8String(const AString& string): std::string(string.toStdString()) {}
+
+    [[nodiscard]]
+    std::string_view view() const noexcept {
+        return *this;
+    }
+
+    /**
+     * @brief Decodes the string to UTF-16.
+     */
+    [[nodiscard]]
+    AString toAString() const {
+        return AString::fromUtf8(data(), size());
+    }
+};
+
+template<>
+struct std::hash<AUtf8String>: std::hash<std::string> {};
+
+template <> struct fmt::formatter<AUtf8String>: fmt::formatter<std::string_view> {
+    auto format(const AUtf8String& s, format_context& ctx) const {
+        return fmt::formatter<std::string_view>::format(s.view(), ctx);
+    }
+};
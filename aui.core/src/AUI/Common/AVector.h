@@ -286,13 +286,13 @@ public:
     }
 
 
-    AVector<StoredType>& sort() noexcept {
+    self& sort() noexcept {
         std::sort(super::begin(), super::end());
         return *this;
     }
 
     template<typename Comparator>
-    AVector<StoredType>& sort(Comparator&& comparator) noexcept {
+    self& sort(Comparator&& comparator) noexcept {
         std::sort(super::begin(), super::end(), std::forward<Comparator>(comparator));
         return *this;
     }
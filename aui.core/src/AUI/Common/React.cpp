@@ -12,6 +12,10 @@
 #include "React.h"
 #include <AUI/Common/AObject.h>
 #include <AUI/Common/AAbstractSignal.h>
+#include <AUI/Util/ARaiiHelper.h>
+#include <algorithm>
+#include <tuple>
+#include <vector>
 
 using namespace aui::react;
 
@@ -19,21 +23,110 @@ namespace {
 thread_local DependencyObserver* gCurrentDependencyObserver = nullptr;
 }
 
+struct aui::react::detail::BatchState {
+    struct Entry {
+        DependencyObserver* observer;
+        unsigned height;
+        std::uint64_t sequence;
+
+        /**
+         * @brief Heap order: lower height first; FIFO among equal heights.
+         */
+        bool operator<(const Entry& rhs) const noexcept {
+            return std::tie(height, sequence) > std::tie(rhs.height, rhs.sequence);
+        }
+    };
+
+    unsigned depth = 0;
+    std::uint64_t sequence = 0;
+    std::vector<Entry> queue;
+};
+
+namespace {
+thread_local detail::BatchState gBatch;
+}
+
+DependencyObserver::~DependencyObserver() {
+    if (mQueuedIn == nullptr) {
+        return;
+    }
+    // the queue belongs to the thread running the batch, which is about to propagate the observer; destroying it on
+    // another thread would race with both.
+    AUI_ASSERTX(mQueuedIn == &gBatch, "an observer queued in a batch is destroyed on another thread");
+    for (auto& entry : mQueuedIn->queue) {
+        if (entry.observer == this) {
+            entry.observer = nullptr;
+        }
+    }
+}
+
 DependencyObserverRegistrar::DependencyObserverRegistrar(DependencyObserver& observer)
   : mPrevObserver(std::exchange(gCurrentDependencyObserver, &observer)) {
     observer.mObserverConnections.clear();
+    observer.mHeight = 1;
 }
 
 DependencyObserverRegistrar::~DependencyObserverRegistrar() { gCurrentDependencyObserver = mPrevObserver; }
 
-void DependencyObserverRegistrar::addDependency(const AAbstractSignal& signal) {
+void DependencyObserverRegistrar::addDependency(const AAbstractSignal& signal, unsigned height) {
     if (!gCurrentDependencyObserver) {
         return;
     }
+    gCurrentDependencyObserver->mHeight = std::max(gCurrentDependencyObserver->mHeight, height + 1);
     if (signal.hasOutgoingConnectionsWith(gCurrentDependencyObserver)) {
         return;
     }
     auto connection = const_cast<AAbstractSignal&>(signal).addGenericObserver(
-        gCurrentDependencyObserver, [observer = gCurrentDependencyObserver] { observer->invalidate(); });
+        gCurrentDependencyObserver, [observer = gCurrentDependencyObserver] { Batch::invalidate(*observer); });
     gCurrentDependencyObserver->mObserverConnections << std::move(connection);
 }
+
+void Batch::begin() {
+    ++gBatch.depth;
+}
+
+void Batch::end() {
+    AUI_ASSERT(gBatch.depth > 0);
+    if (gBatch.depth > 1) {
+        --gBatch.depth;
+        return;
+    }
+
+    // keep batching while propagating, so invalidations caused by propagation are queued by height as well.
+    auto& queue = gBatch.queue;
+    ARaiiHelper d = [&] {
+        // if propagate() has thrown, the rest of the queue is dropped; its observers are already dirty.
+        for (const auto& entry : queue) {
+            if (entry.observer != nullptr) {
+                entry.observer->mQueuedIn = nullptr;
+            }
+        }
+        queue.clear();
+        --gBatch.depth;
+    };
+    while (!queue.empty()) {
+        std::pop_heap(queue.begin(), queue.end());
+        auto entry = queue.back();
+        queue.pop_back();
+        if (entry.observer == nullptr) {
+            // destroyed while queued
+            continue;
+        }
+        entry.observer->mQueuedIn = nullptr;
+        entry.observer->propagate();
+    }
+}
+
+void Batch::invalidate(DependencyObserver& observer) {
+    if (gBatch.depth == 0) {
+        observer.invalidate();
+        return;
+    }
+    observer.markDirty();
+    if (observer.mQueuedIn != nullptr) {
+        return;
+    }
+    observer.mQueuedIn = &gBatch;
+    gBatch.queue.push_back({ &observer, observer.mHeight, gBatch.sequence++ });
+    std::push_heap(gBatch.queue.begin(), gBatch.queue.end());
+}
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <functional>
 #include <AUI/Common/AObjectBase.h>
 
 /**
@@ -20,14 +21,55 @@
  * @sa APropertyPrecomputed
  */
 namespace aui::react {
-struct DependencyObserver : AObjectBase {
+namespace detail {
+struct BatchState;
+}
+
+struct API_AUI_CORE DependencyObserver : AObjectBase {
     friend struct API_AUI_CORE DependencyObserverRegistrar;
+    friend struct Batch;
 
 public:
+    ~DependencyObserver() override;
+
     virtual void invalidate() = 0;
 
+    /**
+     * @brief First phase of invalidation inside aui::react::batch.
+     * @details
+     * Called as soon as a dependency changes. Should drop cached state without notifying anyone. Does nothing by
+     * default.
+     */
+    virtual void markDirty() {}
+
+    /**
+     * @brief Second phase of invalidation inside aui::react::batch.
+     * @details
+     * Called once per batch, after all observers of lower height were propagated. Calls invalidate() by default.
+     */
+    virtual void propagate() { invalidate(); }
+
+    /**
+     * @brief Dependency height.
+     * @details
+     * 1 + max height of dependencies that are reactive expressions themselves; 1 if the expression depends on plain
+     * properties only. Updated on each evaluation of the expression.
+     */
+    [[nodiscard]]
+    unsigned height() const noexcept {
+        return mHeight;
+    }
+
 private:
     AVector<AAbstractSignal::AutoDestroyedConnection> mObserverConnections;
+    unsigned mHeight = 0;
+
+    /**
+     * @brief Batch this observer is queued in, if any.
+     * @details
+     * Accessed by the thread running the batch only; a queued observer must be destroyed on that thread.
+     */
+    detail::BatchState* mQueuedIn = nullptr;
 };
 
 struct API_AUI_CORE DependencyObserverRegistrar {
@@ -36,11 +78,65 @@ struct API_AUI_CORE DependencyObserverRegistrar {
 
     /**
      * @brief Adds observer to the specified signal, if called inside a reactive expression evaluation.
+     * @param signal signal to observe.
+     * @param height height of the dependency if it is a reactive expression itself (see DependencyObserver::height);
+     *        0 for plain properties.
      */
-    static void addDependency(const AAbstractSignal& signal);
+    static void addDependency(const AAbstractSignal& signal, unsigned height = 0);
 
 private:
     DependencyObserver* mPrevObserver;
 };
 
+/**
+ * @brief Reactive transaction state of the current thread.
+ * @details
+ * Use aui::react::batch.
+ */
+struct API_AUI_CORE Batch {
+    static void begin();
+
+    /**
+     * @brief Finishes the batch. When the outermost batch is finished, propagates collected invalidations.
+     */
+    static void end();
+
+    /**
+     * @brief Invalidates the observer, or defers its invalidation if a batch is active on this thread.
+     */
+    static void invalidate(DependencyObserver& observer);
+};
+
+/**
+ * @brief Performs several property updates as a single reactive transaction.
+ * @ingroup property_system
+ * @details
+ * Inside the callable, invalidations of reactive expressions (i.e., APropertyPrecomputed) are only collected. When
+ * the outermost batch finishes, each invalidated expression is recomputed once and emits `changed` once, in the order
+ * of its dependency height. Hence, when derived properties form a diamond, the bottom one is evaluated once and its
+ * observers never see a value computed from partially updated inputs.
+ *
+ * @code{cpp}
+ * AProperty<int> a, b;
+ * APropertyPrecomputed<int> sum = [&] { return a + b; };
+ * aui::react::batch([&] {
+ *     a = 1;
+ *     b = 2;
+ * }); // sum.changed is emitted once with 3
+ * @endcode
+ *
+ * Signals of plain properties are emitted immediately, as usual.
+ */
+template <aui::invocable Callable>
+void batch(Callable&& callable) {
+    Batch::begin();
+    try {
+        std::invoke(std::forward<Callable>(callable));
+    } catch (...) {
+        Batch::end();
+        throw;
+    }
+    Batch::end();
+}
+
 }   // namespace aui::react
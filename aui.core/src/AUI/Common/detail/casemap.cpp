@@ -0,0 +1,229 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cstdint>
+#include <span>
+#include "casemap.h"
+#include "casemap_tables.h"
+#include "simd.h"
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace {
+
+using namespace aui::detail::casemap::tables;
+
+struct Table {
+    const std::uint8_t* index;
+    const std::uint16_t (*deltas)[BLOCK];
+    std::span<const SupplementaryRange> supplementary;
+
+    /**
+     * @brief First letter of the ASCII range this table changes case of.
+     */
+    char16_t asciiFirst;
+
+    char16_t map(char16_t c) const noexcept {
+        return char16_t(c + deltas[index[c >> BLOCK_BITS]][c & (BLOCK - 1)]);
+    }
+
+    char32_t map(char32_t c) const noexcept {
+        for (const auto& range : supplementary) {
+            if (c < range.first) {
+                break;
+            }
+            if (c <= range.last) {
+                return char32_t(std::int32_t(c) + range.delta);
+            }
+        }
+        return c;
+    }
+};
+
+constexpr Table UPPER{ UPPER_INDEX, UPPER_DELTAS, UPPER_SUPPLEMENTARY, u'a' };
+constexpr Table LOWER{ LOWER_INDEX, LOWER_DELTAS, LOWER_SUPPLEMENTARY, u'A' };
+constexpr Table FOLD{ FOLD_INDEX, FOLD_DELTAS, FOLD_SUPPLEMENTARY, u'A' };
+
+bool isHighSurrogate(char16_t c) noexcept {
+    return (c & 0xfc00) == 0xd800;
+}
+
+bool isLowSurrogate(char16_t c) noexcept {
+    return (c & 0xfc00) == 0xdc00;
+}
+
+/**
+ * @brief Maps the code point at src, advancing src past it.
+ * @details
+ * Unpaired surrogates are mapped to themselves.
+ */
+template<typename Output>
+void mapCodePoint(const Table& table, const char16_t*& src, const char16_t* end, Output&& output) noexcept {
+    auto c = *src++;
+    if (isHighSurrogate(c) && src != end && isLowSurrogate(*src)) {
+        char32_t codePoint = 0x10000 + ((char32_t(c) - 0xd800) << 10) + (char32_t(*src++) - 0xdc00);
+        output(table.map(codePoint));
+        return;
+    }
+    output(char32_t(table.map(c)));
+}
+
+char32_t nextFolded(const char16_t*& src, const char16_t* end) noexcept {
+    char32_t result{};
+    mapCodePoint(FOLD, src, end, [&](char32_t c) { result = c; });
+    return result;
+}
+
+/*
+ * ASCII block primitives. Each implementation defines:
+ *
+ * LANES                         - count of code units processed per step;
+ * mapAscii(src, dst, asciiFirst) - if LANES code units of src are ASCII, writes them to dst with case of the 26 letters
+ *                                  starting from asciiFirst flipped and returns true; otherwise, returns false and does
+ *                                  not write anything.
+ */
+
+#if AUI_SIMD_AVX2
+
+constexpr std::size_t LANES = 16;
+
+bool mapAscii(const char16_t* src, char16_t* dst, char16_t asciiFirst) noexcept {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    if (!_mm256_testz_si256(v, _mm256_set1_epi16(short(0xff80)))) {
+        return false;
+    }
+    // values are ASCII, so signed comparisons are fine.
+    auto letter = _mm256_and_si256(_mm256_cmpgt_epi16(v, _mm256_set1_epi16(short(asciiFirst - 1))),
+                                   _mm256_cmpgt_epi16(_mm256_set1_epi16(short(asciiFirst + 26)), v));
+    v = _mm256_xor_si256(v, _mm256_and_si256(letter, _mm256_set1_epi16(0x20)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+    return true;
+}
+
+#elif AUI_SIMD_SSE2
+
+constexpr std::size_t LANES = 8;
+
+bool mapAscii(const char16_t* src, char16_t* dst, char16_t asciiFirst) noexcept {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    auto nonAscii = _mm_and_si128(v, _mm_set1_epi16(short(0xff80)));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) != 0xffff) {
+        return false;
+    }
+    // values are ASCII, so signed comparisons are fine.
+    auto letter = _mm_and_si128(_mm_cmpgt_epi16(v, _mm_set1_epi16(short(asciiFirst - 1))),
+                                _mm_cmplt_epi16(v, _mm_set1_epi16(short(asciiFirst + 26))));
+    v = _mm_xor_si128(v, _mm_and_si128(letter, _mm_set1_epi16(0x20)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+    return true;
+}
+
+#elif AUI_SIMD_NEON
+
+constexpr std::size_t LANES = 8;
+
+bool mapAscii(const char16_t* src, char16_t* dst, char16_t asciiFirst) noexcept {
+    auto v = vld1q_u16(reinterpret_cast<const std::uint16_t*>(src));
+    if (vmaxvq_u16(v) >= 0x80) {
+        return false;
+    }
+    auto letter = vandq_u16(vcgeq_u16(v, vdupq_n_u16(asciiFirst)), vcleq_u16(v, vdupq_n_u16(asciiFirst + 25)));
+    v = veorq_u16(v, vandq_u16(letter, vdupq_n_u16(0x20)));
+    vst1q_u16(reinterpret_cast<std::uint16_t*>(dst), v);
+    return true;
+}
+
+#else
+
+constexpr std::size_t LANES = 1;
+
+bool mapAscii(const char16_t* src, char16_t* dst, char16_t asciiFirst) noexcept {
+    auto c = *src;
+    if (c >= 0x80) {
+        return false;
+    }
+    *dst = c >= asciiFirst && c < asciiFirst + 26 ? c ^ 0x20 : c;
+    return true;
+}
+
+#endif
+
+void map(const Table& table, std::u16string_view string, char16_t* dst) noexcept {
+    const auto* src = string.data();
+    const auto* end = src + string.size();
+    auto write = [&](char32_t c) {
+        if (c < 0x10000) {
+            *dst++ = char16_t(c);
+            return;
+        }
+        c -= 0x10000;
+        *dst++ = char16_t(0xd800 + (c >> 10));
+        *dst++ = char16_t(0xdc00 + (c & 0x3ff));
+    };
+    while (std::size_t(end - src) >= LANES) {
+        if (mapAscii(src, dst, table.asciiFirst)) {
+            src += LANES;
+            dst += LANES;
+            continue;
+        }
+        // map the whole block one by one before trying the next one.
+        for (const auto* blockEnd = src + LANES; src < blockEnd;) {
+            mapCodePoint(table, src, end, write);
+        }
+    }
+    while (src != end) {
+        mapCodePoint(table, src, end, write);
+    }
+}
+
+}
+
+void aui::detail::casemap::toUpper(std::u16string_view src, char16_t* destination) noexcept {
+    map(UPPER, src, destination);
+}
+
+void aui::detail::casemap::toLower(std::u16string_view src, char16_t* destination) noexcept {
+    map(LOWER, src, destination);
+}
+
+int aui::detail::casemap::compareIgnoreCase(std::u16string_view lhs, std::u16string_view rhs) noexcept {
+    const auto* l = lhs.data();
+    const auto* lEnd = l + lhs.size();
+    const auto* r = rhs.data();
+    const auto* rEnd = r + rhs.size();
+    while (l != lEnd && r != rEnd) {
+        if (*l == *r && !isHighSurrogate(*l)) {
+            ++l;
+            ++r;
+            continue;
+        }
+        auto lc = nextFolded(l, lEnd);
+        auto rc = nextFolded(r, rEnd);
+        if (lc != rc) {
+            return lc < rc ? -1 : 1;
+        }
+    }
+    return int(l != lEnd) - int(r != rEnd);
+}
+
+std::size_t aui::detail::casemap::hashIgnoreCase(std::u16string_view string) noexcept {
+    // FNV-1a of folded code points.
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    const auto* src = string.data();
+    const auto* end = src + string.size();
+    while (src != end) {
+        hash ^= nextFolded(src, end);
+        hash *= 0x100000001b3ULL;
+    }
+    return std::size_t(hash);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
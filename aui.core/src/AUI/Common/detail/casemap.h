@@ -0,0 +1,62 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <AUI/Core.h>
+
+/**
+ * @brief Unicode case mapping of UTF-16 used by AString.
+ * @details
+ * Simple (one to one) Unicode case mappings looked up in generated tables (see casemap_tables.py), so the mapped string
+ * always has the same count of code units as the source. Mappings to several characters (i.e., German ß to SS) and
+ * locale specific mappings (Turkish dotted i) are not applied.
+ *
+ * Runs of ASCII are mapped by blocks of 8 (SSE2, NEON) or 16 (AVX2) code units per step.
+ *
+ * Case-insensitive comparison and hashing use simple case folding and do not allocate.
+ */
+namespace aui::detail::casemap {
+
+/**
+ * @brief Maps src to uppercase.
+ * @param destination output buffer of at least src.size() code units. May be equal to src.data().
+ */
+API_AUI_CORE void toUpper(std::u16string_view src, char16_t* destination) noexcept;
+
+/**
+ * @brief Maps src to lowercase.
+ * @param destination output buffer of at least src.size() code units. May be equal to src.data().
+ */
+API_AUI_CORE void toLower(std::u16string_view src, char16_t* destination) noexcept;
+
+/**
+ * @brief Compares case folded code points of the strings.
+ * @return negative value if lhs is less than rhs, zero if they are equal ignoring case, positive value otherwise.
+ */
+API_AUI_CORE int compareIgnoreCase(std::u16string_view lhs, std::u16string_view rhs) noexcept;
+
+/**
+ * @brief Case-insensitive equality.
+ */
+inline bool equalsIgnoreCase(std::u16string_view lhs, std::u16string_view rhs) noexcept {
+    // case folding never changes the count of code units.
+    return lhs.size() == rhs.size() && compareIgnoreCase(lhs, rhs) == 0;
+}
+
+/**
+ * @return hash of case folded code points, so strings equal ignoring case have equal hashes.
+ */
+API_AUI_CORE std::size_t hashIgnoreCase(std::u16string_view string) noexcept;
+
+}
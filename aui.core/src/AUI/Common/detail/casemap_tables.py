@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# Generates casemap_tables.h: simple (1:1) Unicode case mappings used by casemap.cpp.
+#
+#   python3 casemap_tables.py > casemap_tables.h
+#
+# The mappings come from the unicodedata of the running Python. Python exposes full case mappings only, so a full
+# mapping to several characters (SpecialCasing.txt) is replaced by the simple one: the titlecase mapping for upper
+# (Greek with ypogegrammeni), U+0130 -> U+0069 for lower, the simple lowercase for folding; otherwise the character
+# maps to itself.
+
+import sys
+import unicodedata
+
+BLOCK_BITS = 5
+BLOCK = 1 << BLOCK_BITS
+
+
+def single(s):
+    return ord(s) if len(s) == 1 else None
+
+
+def upper(c):
+    ch = chr(c)
+    return single(ch.upper()) or single(ch.title()) or c
+
+
+def lower(c):
+    if c == 0x130:
+        return 0x69
+    return single(chr(c).lower()) or c
+
+
+def fold(c):
+    return single(chr(c).casefold()) or lower(c)
+
+
+def is_bmp(c):
+    return c < 0x10000
+
+
+def bmp_table(name, mapping):
+    deltas = []
+    for c in range(0x10000):
+        if 0xD800 <= c < 0xE000:
+            deltas.append(0)
+            continue
+        m = mapping(c)
+        assert is_bmp(m), hex(c)
+        deltas.append((m - c) & 0xFFFF)
+    blocks = []
+    index = []
+    for i in range(0, 0x10000, BLOCK):
+        block = tuple(deltas[i:i + BLOCK])
+        if block not in blocks:
+            blocks.append(block)
+        index.append(blocks.index(block))
+    assert len(blocks) <= 256
+    out = [f"constexpr std::uint8_t {name}_INDEX[] = {{"]
+    for i in range(0, len(index), 32):
+        out.append("    " + ", ".join(str(x) for x in index[i:i + 32]) + ",")
+    out.append("};")
+    out.append(f"constexpr std::uint16_t {name}_DELTAS[][{BLOCK}] = {{")
+    for block in blocks:
+        out.append("    {")
+        for i in range(0, BLOCK, 16):
+            out.append("        " + ", ".join(f"0x{x:04x}" for x in block[i:i + 16]) + ",")
+        out.append("    },")
+    out.append("};")
+    return out, len(index) + len(blocks) * BLOCK * 2
+
+
+def supplementary_table(name, mapping):
+    ranges = []
+    for c in range(0x10000, 0x110000):
+        m = mapping(c)
+        if m == c:
+            continue
+        assert not is_bmp(m), hex(c)
+        delta = m - c
+        if ranges and ranges[-1][1] == c - 1 and ranges[-1][2] == delta:
+            ranges[-1][1] = c
+        else:
+            ranges.append([c, c, delta])
+    out = [f"constexpr SupplementaryRange {name}_SUPPLEMENTARY[] = {{"]
+    for first, last, delta in ranges:
+        out.append(f"    {{ 0x{first:05x}, 0x{last:05x}, {delta} }},")
+    out.append("};")
+    return out
+
+
+def main():
+    out = [
+        "/*",
+        " * AUI Framework - Declarative UI toolkit for modern C++20",
+        " * Copyright (C) 2020-2025 Alex2772 and Contributors",
+        " *",
+        " * SPDX-License-Identifier: MPL-2.0",
+        " *",
+        " * This Source Code Form is subject to the terms of the Mozilla Public",
+        " * License, v. 2.0. If a copy of the MPL was not distributed with this",
+        " * file, You can obtain one at http://mozilla.org/MPL/2.0/.",
+        " */",
+        "",
+        f"// Generated by casemap_tables.py from Unicode {unicodedata.unidata_version}. Do not edit.",
+        "//",
+        "// A BMP code unit c maps to c + X_DELTAS[X_INDEX[c >> BLOCK_BITS]][c & (BLOCK - 1)] (mod 2^16). A supplementary",
+        "// code point maps to itself + delta of the range containing it, if any.",
+        "",
+        "#pragma once",
+        "",
+        "#include <cstdint>",
+        "",
+        "namespace aui::detail::casemap::tables {",
+        "",
+        f"constexpr unsigned BLOCK_BITS = {BLOCK_BITS};",
+        f"constexpr unsigned BLOCK = {BLOCK};",
+        "",
+        "struct SupplementaryRange {",
+        "    char32_t first;",
+        "    char32_t last;",
+        "    std::int32_t delta;",
+        "};",
+        "",
+    ]
+    total = 0
+    for name, mapping in (("UPPER", upper), ("LOWER", lower), ("FOLD", fold)):
+        table, size = bmp_table(name, mapping)
+        total += size
+        out += table
+        out.append("")
+        out += supplementary_table(name, mapping)
+        out.append("")
+    out.append("}")
+    print(f"BMP tables: {total} bytes", file=sys.stderr)
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,908 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "map_slot.h"
+
+/*
+ * Unlike detail/simd.h, only the baseline instruction sets are used here: a group is 16 control bytes, which is
+ * exactly one SSE2 or NEON register.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUI_FLAT_HASH_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define AUI_FLAT_HASH_NEON 1
+#include <arm_neon.h>
+#endif
+
+/*
+ * Open addressing hash table behind AFlatHashMap and AFlatHashSet, laid out as SwissTable.
+ *
+ * Elements are stored in a single array of slots. Each slot has a control byte in a separate array: EMPTY, DELETED or,
+ * for a full slot, the low 7 bits of the element hash (H2). The control bytes are split into aligned groups of 16; the
+ * remaining bits of the hash (H1) select the group the probe starts from. A lookup compares H2 against the whole group
+ * at once and compares keys only for the matching slots, which, for 7 bits of hash, is almost always the right one.
+ * The probe stops at the first group having an empty slot; if there is none, it continues to the next group in the
+ * quadratic sequence.
+ *
+ * The table is kept at most 7/8 full, so probe sequences stay short. Erased elements are marked DELETED only when
+ * their group is full, since a probe might have passed it; otherwise the slot becomes EMPTY again.
+ */
+namespace aui::detail::flat_hash {
+    using ctrl_t = std::int8_t;
+
+    inline constexpr ctrl_t EMPTY = -128;
+    inline constexpr ctrl_t DELETED = -2;
+
+    /**
+     * Terminates the control bytes, so iteration stops without checking the capacity.
+     */
+    inline constexpr ctrl_t SENTINEL = -1;
+
+    inline constexpr std::size_t GROUP_WIDTH = 16;
+
+    /**
+     * Control bytes of a table with no allocated storage.
+     */
+    inline constexpr ctrl_t EMPTY_TABLE[1] = { SENTINEL };
+
+    inline bool isFull(ctrl_t ctrl) noexcept {
+        return ctrl >= 0;
+    }
+
+    inline bool isEmptyOrDeleted(ctrl_t ctrl) noexcept {
+        return ctrl < SENTINEL;
+    }
+
+    /**
+     * Spreads hashes of std::hash implementations that return the value itself (integers, pointers), since slots are
+     * selected by the bits of the hash directly.
+     */
+    inline std::size_t mix(std::size_t hash) noexcept {
+        if constexpr (sizeof(std::size_t) == 8) {
+            // murmur3 finalizer
+            std::uint64_t h = hash;
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            h *= 0xc4ceb9fe1a85ec53ULL;
+            h ^= h >> 33;
+            return std::size_t(h);
+        } else {
+            std::uint32_t h = std::uint32_t(hash);
+            h ^= h >> 16;
+            h *= 0x85ebca6bU;
+            h ^= h >> 13;
+            h *= 0xc2b2ae35U;
+            h ^= h >> 16;
+            return std::size_t(h);
+        }
+    }
+
+    inline std::size_t h1(std::size_t hash) noexcept {
+        return hash >> 7;
+    }
+
+    inline ctrl_t h2(std::size_t hash) noexcept {
+        return ctrl_t(hash & 0x7f);
+    }
+
+    /**
+     * @return maximal count of elements in a table of the specified capacity.
+     */
+    constexpr std::size_t maxLoad(std::size_t capacity) noexcept {
+        return capacity - capacity / 8;
+    }
+
+    /**
+     * @return minimal capacity fitting the specified count of elements.
+     */
+    constexpr std::size_t capacityFor(std::size_t size) noexcept {
+        std::size_t capacity = GROUP_WIDTH;
+        while (maxLoad(capacity) < size) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    /**
+     * Set of slots of a group matching a condition.
+     */
+    class BitMask {
+    public:
+#if AUI_FLAT_HASH_NEON
+        // 4 bits per slot
+        static constexpr int SHIFT = 2;
+#else
+        static constexpr int SHIFT = 0;
+#endif
+
+        explicit BitMask(std::uint64_t mask) noexcept: mMask(mask) {}
+
+        explicit operator bool() const noexcept {
+            return mMask != 0;
+        }
+
+        [[nodiscard]]
+        std::size_t lowest() const noexcept {
+            return std::size_t(std::countr_zero(mMask)) >> SHIFT;
+        }
+
+        void removeLowest() noexcept {
+            mMask &= mMask - 1;
+        }
+
+    private:
+        std::uint64_t mMask;
+    };
+
+    /**
+     * Aligned group of GROUP_WIDTH control bytes.
+     */
+    class Group {
+    public:
+        explicit Group(const ctrl_t* ctrl) noexcept {
+#if AUI_FLAT_HASH_SSE2
+            mCtrl = _mm_load_si128(reinterpret_cast<const __m128i*>(ctrl));
+#elif AUI_FLAT_HASH_NEON
+            mCtrl = vld1q_s8(ctrl);
+#else
+            std::memcpy(mCtrl, ctrl, GROUP_WIDTH);
+#endif
+        }
+
+        [[nodiscard]]
+        BitMask match(ctrl_t value) const noexcept {
+#if AUI_FLAT_HASH_SSE2
+            return BitMask(std::uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), mCtrl))));
+#elif AUI_FLAT_HASH_NEON
+            return toMask(vceqq_s8(vdupq_n_s8(value), mCtrl));
+#else
+            return matchIf([&](ctrl_t c) { return c == value; });
+#endif
+        }
+
+        [[nodiscard]]
+        BitMask matchEmpty() const noexcept {
+            return match(EMPTY);
+        }
+
+        [[nodiscard]]
+        BitMask matchEmptyOrDeleted() const noexcept {
+#if AUI_FLAT_HASH_SSE2
+            return BitMask(std::uint32_t(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(SENTINEL), mCtrl))));
+#elif AUI_FLAT_HASH_NEON
+            return toMask(vcltq_s8(mCtrl, vdupq_n_s8(SENTINEL)));
+#else
+            return matchIf([](ctrl_t c) { return isEmptyOrDeleted(c); });
+#endif
+        }
+
+    private:
+#if AUI_FLAT_HASH_SSE2
+        __m128i mCtrl;
+#elif AUI_FLAT_HASH_NEON
+        int8x16_t mCtrl;
+
+        static BitMask toMask(uint8x16_t matches) noexcept {
+            // narrows each byte to a nibble; there is no movemask on NEON.
+            auto nibbles = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+            return BitMask(vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ULL);
+        }
+#else
+        ctrl_t mCtrl[GROUP_WIDTH];
+
+        template<typename Predicate>
+        BitMask matchIf(Predicate&& predicate) const noexcept {
+            std::uint64_t mask = 0;
+            for (std::size_t i = 0; i < GROUP_WIDTH; ++i) {
+                mask |= std::uint64_t(predicate(mCtrl[i])) << i;
+            }
+            return BitMask(mask);
+        }
+#endif
+    };
+
+    /**
+     * Storage of a set element.
+     */
+    template<typename Value>
+    union SetSlot {
+        static constexpr bool NOTHROW_MOVE = std::is_nothrow_move_constructible_v<Value>;
+
+        Value value;
+
+        SetSlot() noexcept {}
+        ~SetSlot() {}
+
+        template<typename... Args>
+        void construct(Args&&... args) {
+            new (std::addressof(value)) Value(std::forward<Args>(args)...);
+        }
+
+        void destroy() noexcept {
+            value.~Value();
+        }
+
+        /**
+         * Moves the element from src to uninitialized dst and destroys src.
+         */
+        static void relocate(SetSlot* dst, SetSlot* src) noexcept(NOTHROW_MOVE) {
+            dst->construct(std::move(src->value));
+            src->destroy();
+        }
+    };
+
+    struct MapKey {
+        template<typename Pair>
+        using Slot = MapSlot<std::remove_const_t<typename Pair::first_type>, typename Pair::second_type>;
+
+        template<typename Pair>
+        const auto& operator()(const Pair& pair) const noexcept {
+            return pair.first;
+        }
+    };
+
+    struct SetKey {
+        template<typename Key>
+        using Slot = SetSlot<Key>;
+
+        template<typename Key>
+        const Key& operator()(const Key& key) const noexcept {
+            return key;
+        }
+    };
+
+    template<typename Value, typename Key, typename KeyOf, typename Hash, typename KeyEqual>
+    class Table;
+
+    template<typename Value, typename Slot, bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Value;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, const Value&, Value&>;
+        using pointer = std::conditional_t<Const, const Value*, Value*>;
+
+        Iterator() noexcept = default;
+
+        template<bool OtherConst> requires (Const && !OtherConst)
+        Iterator(const Iterator<Value, Slot, OtherConst>& other) noexcept: mCtrl(other.mCtrl), mSlot(other.mSlot) {}
+
+        reference operator*() const noexcept {
+            return mSlot->value;
+        }
+
+        pointer operator->() const noexcept {
+            return std::addressof(mSlot->value);
+        }
+
+        Iterator& operator++() noexcept {
+            ++mCtrl;
+            ++mSlot;
+            skipEmpty();
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.mCtrl == rhs.mCtrl;
+        }
+
+    private:
+        template<typename, typename, bool>
+        friend class Iterator;
+
+        template<typename, typename, typename, typename, typename>
+        friend class Table;
+
+        const ctrl_t* mCtrl = nullptr;
+        Slot* mSlot = nullptr;
+
+        Iterator(const ctrl_t* ctrl, Slot* slot) noexcept: mCtrl(ctrl), mSlot(slot) {}
+
+        void skipEmpty() noexcept {
+            while (isEmptyOrDeleted(*mCtrl)) {
+                ++mCtrl;
+                ++mSlot;
+            }
+        }
+    };
+
+    /**
+     * @tparam Value stored element.
+     * @tparam Key key of the element.
+     * @tparam KeyOf extracts the key from the element; KeyOf::Slot<Value> stores the element.
+     */
+    template<typename Value, typename Key, typename KeyOf, typename Hash, typename KeyEqual>
+    class Table {
+    public:
+        using key_type = Key;
+        using value_type = Value;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+    private:
+        using slot_type = typename KeyOf::template Slot<Value>;
+
+    public:
+        // elements of a set are keys, which must not be modified in place.
+        using iterator = Iterator<Value, slot_type, std::is_same_v<Key, Value>>;
+        using const_iterator = Iterator<Value, slot_type, true>;
+
+        Table() noexcept = default;
+
+        explicit Table(size_type capacity, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual()):
+            mHash(hash), mEqual(equal) {
+            reserve(capacity);
+        }
+
+        template<typename InputIterator>
+        Table(InputIterator first, InputIterator last) {
+            insert(first, last);
+        }
+
+        Table(std::initializer_list<value_type> init) {
+            reserve(init.size());
+            insert(init.begin(), init.end());
+        }
+
+        Table(const Table& other): mHash(other.mHash), mEqual(other.mEqual) {
+            reserve(other.size());
+            try {
+                for (const auto& value : other) {
+                    // keys of other are distinct already, there's nothing to compare with.
+                    auto hash = hashOf(KeyOf{}(value));
+                    auto index = findFirstNonFull(hash);
+                    mSlots[index].construct(value);
+                    setFull(index, hash);
+                }
+            } catch (...) {
+                destroy();
+                throw;
+            }
+        }
+
+        Table(Table&& other) noexcept: mHash(std::move(other.mHash)), mEqual(std::move(other.mEqual)) {
+            steal(other);
+        }
+
+        Table& operator=(const Table& other) {
+            if (this != &other) {
+                Table copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+
+        Table& operator=(Table&& other) noexcept {
+            if (this != &other) {
+                destroy();
+                mHash = std::move(other.mHash);
+                mEqual = std::move(other.mEqual);
+                steal(other);
+            }
+            return *this;
+        }
+
+        Table& operator=(std::initializer_list<value_type> init) {
+            clear();
+            insert(init);
+            return *this;
+        }
+
+        ~Table() {
+            destroy();
+        }
+
+        iterator begin() noexcept {
+            auto it = iteratorAt(0);
+            it.skipEmpty();
+            return it;
+        }
+
+        const_iterator begin() const noexcept {
+            return const_cast<Table*>(this)->begin();
+        }
+
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        iterator end() noexcept {
+            return iteratorAt(mCapacity);
+        }
+
+        const_iterator end() const noexcept {
+            return const_cast<Table*>(this)->end();
+        }
+
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return mSize == 0;
+        }
+
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return mSize;
+        }
+
+        /**
+         * @return count of slots, including the ones reserved to keep the load factor.
+         */
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return mCapacity;
+        }
+
+        /**
+         * @brief Destroys all elements keeping the allocated storage.
+         */
+        void clear() noexcept {
+            destroySlots();
+            if (mCapacity != 0) {
+                std::memset(mCtrl, EMPTY, mCapacity);
+            }
+            mSize = 0;
+            mGrowthLeft = maxLoad(mCapacity);
+        }
+
+        /**
+         * @brief Allocates storage for the specified count of elements, so inserting them does not rehash.
+         */
+        void reserve(size_type count) {
+            if (count > mSize + mGrowthLeft) {
+                resize(capacityFor(std::max(count, mSize)));
+            }
+        }
+
+        iterator find(const key_type& key) {
+            if (mSize == 0) {
+                return end();
+            }
+            return iteratorAt(findIndex(key, hashOf(key)));
+        }
+
+        const_iterator find(const key_type& key) const {
+            return const_cast<Table*>(this)->find(key);
+        }
+
+        [[nodiscard]]
+        size_type count(const key_type& key) const {
+            return find(key) != end() ? 1 : 0;
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value) {
+            auto [index, inserted] = findOrPrepareInsert(KeyOf{}(value));
+            if (inserted) {
+                constructAt(index, value);
+            }
+            return { iteratorAt(index), inserted };
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value) {
+            auto [index, inserted] = findOrPrepareInsert(KeyOf{}(value));
+            if (inserted) {
+                constructAt(index, std::move(value));
+            }
+            return { iteratorAt(index), inserted };
+        }
+
+        template<typename InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            for (; first != last; ++first) {
+                emplace(*first);
+            }
+        }
+
+        void insert(std::initializer_list<value_type> init) {
+            insert(init.begin(), init.end());
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args) {
+            if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, value_type> && ...)) {
+                return insert(std::forward<Args>(args)...);
+            } else {
+                // the key is not known until the element is constructed.
+                return insert(value_type(std::forward<Args>(args)...));
+            }
+        }
+
+        /**
+         * @return iterator to the element following the erased one.
+         */
+        iterator erase(const_iterator position) {
+            auto index = size_type(position.mCtrl - mCtrl);
+            mSlots[index].destroy();
+            eraseMeta(index);
+            auto it = iteratorAt(index);
+            it.skipEmpty();
+            return it;
+        }
+
+        iterator erase(iterator position) requires (!std::is_same_v<iterator, const_iterator>) {
+            return erase(const_iterator(position));
+        }
+
+        size_type erase(const key_type& key) {
+            auto it = find(key);
+            if (it == end()) {
+                return 0;
+            }
+            erase(it);
+            return 1;
+        }
+
+        void swap(Table& other) noexcept {
+            using std::swap;
+            swap(mCtrl, other.mCtrl);
+            swap(mSlots, other.mSlots);
+            swap(mCapacity, other.mCapacity);
+            swap(mSize, other.mSize);
+            swap(mGrowthLeft, other.mGrowthLeft);
+            swap(mHash, other.mHash);
+            swap(mEqual, other.mEqual);
+        }
+
+        friend void swap(Table& lhs, Table& rhs) noexcept {
+            lhs.swap(rhs);
+        }
+
+        hasher hash_function() const {
+            return mHash;
+        }
+
+        key_equal key_eq() const {
+            return mEqual;
+        }
+
+        friend bool operator==(const Table& lhs, const Table& rhs) {
+            if (lhs.size() != rhs.size()) {
+                return false;
+            }
+            for (const auto& value : lhs) {
+                auto it = rhs.find(KeyOf{}(value));
+                if (it == rhs.end() || !(*it == value)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    protected:
+        /**
+         * @return index of the element with the specified key and false, or index of the slot prepared for the
+         *         element and true. The caller must construct the element with constructAt then.
+         */
+        template<typename K>
+        std::pair<size_type, bool> findOrPrepareInsert(const K& key) {
+            auto hash = hashOf(key);
+            if (mSize != 0) {
+                if (auto index = findIndex(key, hash); index != mCapacity) {
+                    return { index, false };
+                }
+            }
+            return { prepareInsert(hash), true };
+        }
+
+        template<typename... Args>
+        void constructAt(size_type index, Args&&... args) {
+            try {
+                mSlots[index].construct(std::forward<Args>(args)...);
+            } catch (...) {
+                eraseMeta(index);
+                throw;
+            }
+        }
+
+        iterator iteratorAt(size_type index) noexcept {
+            return { mCtrl + index, mSlots + index };
+        }
+
+    private:
+        static constexpr std::size_t ALIGNMENT = std::max(alignof(slot_type), GROUP_WIDTH);
+
+        ctrl_t* mCtrl = const_cast<ctrl_t*>(EMPTY_TABLE);
+        slot_type* mSlots = nullptr;
+        size_type mCapacity = 0;
+        size_type mSize = 0;
+
+        /**
+         * Count of elements that can be inserted to the empty slots before rehashing.
+         */
+        size_type mGrowthLeft = 0;
+
+        [[no_unique_address]] Hash mHash;
+        [[no_unique_address]] KeyEqual mEqual;
+
+        template<typename K>
+        size_type hashOf(const K& key) const {
+            return mix(mHash(key));
+        }
+
+        template<typename K>
+        size_type findIndex(const K& key, size_type hash) const {
+            auto groupMask = mCapacity / GROUP_WIDTH - 1;
+            auto group = h1(hash) & groupMask;
+            for (size_type step = 1;; ++step) {
+                Group g(mCtrl + group * GROUP_WIDTH);
+                for (auto mask = g.match(h2(hash)); mask; mask.removeLowest()) {
+                    auto index = group * GROUP_WIDTH + mask.lowest();
+                    if (mEqual(KeyOf{}(mSlots[index].value), key)) {
+                        return index;
+                    }
+                }
+                if (g.matchEmpty()) {
+                    return mCapacity;
+                }
+                group = (group + step) & groupMask;
+            }
+        }
+
+        size_type findFirstNonFull(size_type hash) const noexcept {
+            auto groupMask = mCapacity / GROUP_WIDTH - 1;
+            auto group = h1(hash) & groupMask;
+            for (size_type step = 1;; ++step) {
+                if (auto mask = Group(mCtrl + group * GROUP_WIDTH).matchEmptyOrDeleted()) {
+                    return group * GROUP_WIDTH + mask.lowest();
+                }
+                group = (group + step) & groupMask;
+            }
+        }
+
+        size_type prepareInsert(size_type hash) {
+            if (mCapacity == 0) {
+                resize(GROUP_WIDTH);
+            }
+            auto index = findFirstNonFull(hash);
+            if (mGrowthLeft == 0 && mCtrl[index] != DELETED) {
+                // when most of the load is tombstones, dropping them is enough.
+                resize(mSize < maxLoad(mCapacity) / 2 ? mCapacity : mCapacity * 2);
+                index = findFirstNonFull(hash);
+            }
+            setFull(index, hash);
+            return index;
+        }
+
+        void setFull(size_type index, size_type hash) noexcept {
+            if (mCtrl[index] == EMPTY) {
+                --mGrowthLeft;
+            }
+            mCtrl[index] = h2(hash);
+            ++mSize;
+        }
+
+        void eraseMeta(size_type index) noexcept {
+            --mSize;
+            if (Group(mCtrl + (index & ~(GROUP_WIDTH - 1))).matchEmpty()) {
+                // no probe has passed a group having an empty slot.
+                mCtrl[index] = EMPTY;
+                ++mGrowthLeft;
+            } else {
+                mCtrl[index] = DELETED;
+            }
+        }
+
+        static size_type slotsOffset(size_type capacity) noexcept {
+            // control bytes and the sentinel come first.
+            return (capacity + 1 + alignof(slot_type) - 1) / alignof(slot_type) * alignof(slot_type);
+        }
+
+        void allocate(size_type capacity) {
+            auto memory = static_cast<std::byte*>(
+                ::operator new(slotsOffset(capacity) + capacity * sizeof(slot_type), std::align_val_t(ALIGNMENT)));
+            mCtrl = reinterpret_cast<ctrl_t*>(memory);
+            mSlots = reinterpret_cast<slot_type*>(memory + slotsOffset(capacity));
+            std::memset(mCtrl, EMPTY, capacity);
+            mCtrl[capacity] = SENTINEL;
+            mCapacity = capacity;
+            mGrowthLeft = maxLoad(capacity) - mSize;
+        }
+
+        static void deallocate(ctrl_t* ctrl, size_type capacity) noexcept {
+            if (capacity != 0) {
+                ::operator delete(ctrl, std::align_val_t(ALIGNMENT));
+            }
+        }
+
+        void resize(size_type capacity) {
+            auto oldCtrl = mCtrl;
+            auto oldSlots = mSlots;
+            auto oldCapacity = mCapacity;
+            auto oldGrowthLeft = mGrowthLeft;
+            allocate(capacity);
+            if constexpr (slot_type::NOTHROW_MOVE) {
+                for (size_type i = 0; i < oldCapacity; ++i) {
+                    if (isFull(oldCtrl[i])) {
+                        slot_type::relocate(mSlots + placeRehashed(oldSlots[i].value), oldSlots + i);
+                    }
+                }
+            } else {
+                // a throwing move would lose the elements moved so far; copy them, as std::vector does, and keep the
+                // old storage intact until all of them are copied.
+                try {
+                    for (size_type i = 0; i < oldCapacity; ++i) {
+                        if (isFull(oldCtrl[i])) {
+                            auto& value = oldSlots[i].value;
+                            auto index = placeRehashed(value);
+                            try {
+                                mSlots[index].construct(std::move_if_noexcept(value));
+                            } catch (...) {
+                                mCtrl[index] = EMPTY;
+                                throw;
+                            }
+                        }
+                    }
+                } catch (...) {
+                    destroySlots();
+                    deallocate(mCtrl, mCapacity);
+                    mCtrl = oldCtrl;
+                    mSlots = oldSlots;
+                    mCapacity = oldCapacity;
+                    mGrowthLeft = oldGrowthLeft;
+                    throw;
+                }
+                for (size_type i = 0; i < oldCapacity; ++i) {
+                    if (isFull(oldCtrl[i])) {
+                        oldSlots[i].destroy();
+                    }
+                }
+            }
+            deallocate(oldCtrl, oldCapacity);
+        }
+
+        /**
+         * Marks the slot for the element being moved to the new storage by resize.
+         */
+        size_type placeRehashed(const Value& value) {
+            auto hash = hashOf(KeyOf{}(value));
+            auto index = findFirstNonFull(hash);
+            mCtrl[index] = h2(hash);
+            return index;
+        }
+
+        void destroySlots() noexcept {
+            if constexpr (!std::is_trivially_destructible_v<Value>) {
+                for (size_type i = 0; i < mCapacity; ++i) {
+                    if (isFull(mCtrl[i])) {
+                        mSlots[i].destroy();
+                    }
+                }
+            }
+        }
+
+        void destroy() noexcept {
+            destroySlots();
+            deallocate(mCtrl, mCapacity);
+            reset();
+        }
+
+        void reset() noexcept {
+            mCtrl = const_cast<ctrl_t*>(EMPTY_TABLE);
+            mSlots = nullptr;
+            mCapacity = 0;
+            mSize = 0;
+            mGrowthLeft = 0;
+        }
+
+        void steal(Table& other) noexcept {
+            mCtrl = other.mCtrl;
+            mSlots = other.mSlots;
+            mCapacity = other.mCapacity;
+            mSize = other.mSize;
+            mGrowthLeft = other.mGrowthLeft;
+            other.reset();
+        }
+    };
+
+    /**
+     * Table of key-value pairs with the std::unordered_map interface.
+     */
+    template<typename Key, typename Value, typename Hash, typename KeyEqual>
+    class Map: public Table<std::pair<const Key, Value>, Key, MapKey, Hash, KeyEqual> {
+        using super = Table<std::pair<const Key, Value>, Key, MapKey, Hash, KeyEqual>;
+
+    public:
+        using mapped_type = Value;
+        using typename super::iterator;
+        using typename super::const_iterator;
+
+        using super::super;
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+            auto [index, inserted] = this->findOrPrepareInsert(key);
+            if (inserted) {
+                this->constructAt(index, std::piecewise_construct, std::forward_as_tuple(key),
+                                  std::forward_as_tuple(std::forward<Args>(args)...));
+            }
+            return { this->iteratorAt(index), inserted };
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+            auto [index, inserted] = this->findOrPrepareInsert(key);
+            if (inserted) {
+                this->constructAt(index, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+                                  std::forward_as_tuple(std::forward<Args>(args)...));
+            }
+            return { this->iteratorAt(index), inserted };
+        }
+
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+            auto result = try_emplace(key, std::forward<M>(value));
+            if (!result.second) {
+                result.first->second = std::forward<M>(value);
+            }
+            return result;
+        }
+
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(Key&& key, M&& value) {
+            auto result = try_emplace(std::move(key), std::forward<M>(value));
+            if (!result.second) {
+                result.first->second = std::forward<M>(value);
+            }
+            return result;
+        }
+
+        Value& operator[](const Key& key) {
+            return try_emplace(key).first->second;
+        }
+
+        Value& operator[](Key&& key) {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+        Value& at(const Key& key) {
+            auto it = this->find(key);
+            if (it == this->end()) {
+                throw std::out_of_range("no such key");
+            }
+            return it->second;
+        }
+
+        const Value& at(const Key& key) const {
+            return const_cast<Map*>(this)->at(key);
+        }
+    };
+}
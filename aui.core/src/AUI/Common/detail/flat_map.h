@@ -0,0 +1,486 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "map_slot.h"
+
+namespace aui::detail::flat_map {
+    /**
+     * Stored element. Inserting and erasing shift the elements, which moves and assigns their keys.
+     */
+    template<typename Key, typename Value>
+    class Element {
+        using Slot = MapSlot<Key, Value>;
+
+    public:
+        using value_type = typename Slot::value_type;
+
+        template<typename... Args>
+        explicit Element(std::in_place_t, Args&&... args) {
+            mSlot.construct(std::forward<Args>(args)...);
+        }
+
+        /**
+         * Converts elements of the ranges being inserted.
+         */
+        template<typename Pair>
+        requires (!std::is_same_v<std::remove_cvref_t<Pair>, Element> && std::is_constructible_v<value_type, Pair&&>)
+        Element(Pair&& pair) {
+            mSlot.construct(std::forward<Pair>(pair));
+        }
+
+        Element(const Element& other) {
+            mSlot.construct(other.get());
+        }
+
+        Element(Element&& other) noexcept(Slot::NOTHROW_MOVE) {
+            mSlot.constructMoving(other.mSlot);
+        }
+
+        Element& operator=(const Element& other) {
+            if (this != &other) {
+                *this = Element(other);
+            }
+            return *this;
+        }
+
+        Element& operator=(Element&& other) noexcept(
+            !Slot::MUTABLE_KEYS || std::is_nothrow_move_assignable_v<typename Slot::mutable_value_type>) {
+            if (this == &other) {
+                return *this;
+            }
+            if constexpr (Slot::MUTABLE_KEYS) {
+                mSlot.mutableValue = std::move(other.mSlot.mutableValue);
+            } else {
+                // the const key can't be assigned, so the element is constructed again; the destroyed element can't be
+                // restored if that throws, so this operator is noexcept.
+                mSlot.destroy();
+                mSlot.constructMoving(other.mSlot);
+            }
+            return *this;
+        }
+
+        ~Element() {
+            mSlot.destroy();
+        }
+
+        [[nodiscard]]
+        value_type& get() noexcept {
+            return mSlot.value;
+        }
+
+        [[nodiscard]]
+        const value_type& get() const noexcept {
+            return mSlot.value;
+        }
+
+        [[nodiscard]]
+        const Key& key() const noexcept {
+            return mSlot.value.first;
+        }
+
+        friend bool operator==(const Element& lhs, const Element& rhs) {
+            return lhs.get() == rhs.get();
+        }
+
+    private:
+        Slot mSlot;
+    };
+
+    /**
+     * Iterator over the stored elements presenting them as std::pair<const Key, Value>, so keys can't be modified in
+     * place.
+     */
+    template<typename BaseIterator, typename Reference>
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_cvref_t<Reference>;
+        using difference_type = std::ptrdiff_t;
+        using reference = Reference;
+        using pointer = std::remove_reference_t<Reference>*;
+
+        Iterator() noexcept = default;
+
+        explicit Iterator(BaseIterator base) noexcept: mBase(base) {}
+
+        template<typename OtherBase, typename OtherReference>
+        requires std::is_convertible_v<OtherBase, BaseIterator>
+        Iterator(const Iterator<OtherBase, OtherReference>& other) noexcept: mBase(other.base()) {}
+
+        [[nodiscard]]
+        const BaseIterator& base() const noexcept {
+            return mBase;
+        }
+
+        reference operator*() const noexcept {
+            return *operator->();
+        }
+
+        pointer operator->() const noexcept {
+            return std::addressof(mBase->get());
+        }
+
+        reference operator[](difference_type n) const noexcept {
+            return *(*this + n);
+        }
+
+        Iterator& operator++() noexcept {
+            ++mBase;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept {
+            return Iterator(mBase++);
+        }
+
+        Iterator& operator--() noexcept {
+            --mBase;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept {
+            return Iterator(mBase--);
+        }
+
+        Iterator& operator+=(difference_type n) noexcept {
+            mBase += n;
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n) noexcept {
+            mBase -= n;
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it) noexcept {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.mBase - rhs.mBase;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.mBase == rhs.mBase;
+        }
+
+        friend auto operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept {
+            return lhs.mBase <=> rhs.mBase;
+        }
+
+    private:
+        BaseIterator mBase;
+    };
+    /**
+     * Vector of key-value pairs sorted by key, with the std::map interface.
+     */
+    template<typename Key, typename Value, typename Compare, typename Allocator>
+    class Map {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = std::pair<const Key, Value>;
+        using key_compare = Compare;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+
+    private:
+        using stored_type = Element<Key, Value>;
+        using container_type =
+            std::vector<stored_type, typename std::allocator_traits<Allocator>::template rebind_alloc<stored_type>>;
+
+    public:
+        using iterator = Iterator<typename container_type::iterator, value_type&>;
+        using const_iterator = Iterator<typename container_type::const_iterator, const value_type&>;
+
+        Map() = default;
+
+        explicit Map(const Compare& compare, const Allocator& allocator = Allocator()):
+            mItems(allocator), mCompare(compare) {}
+
+        template<typename InputIterator>
+        Map(InputIterator first, InputIterator last, const Compare& compare = Compare()):
+            mItems(first, last), mCompare(compare) {
+            sortUnique();
+        }
+
+        Map(std::initializer_list<value_type> init, const Compare& compare = Compare()):
+            Map(init.begin(), init.end(), compare) {}
+
+        Map& operator=(std::initializer_list<value_type> init) {
+            mItems.clear();
+            insert(init.begin(), init.end());
+            return *this;
+        }
+
+        iterator begin() noexcept {
+            return iterator(mItems.begin());
+        }
+
+        const_iterator begin() const noexcept {
+            return const_iterator(mItems.begin());
+        }
+
+        const_iterator cbegin() const noexcept {
+            return const_iterator(mItems.cbegin());
+        }
+
+        iterator end() noexcept {
+            return iterator(mItems.end());
+        }
+
+        const_iterator end() const noexcept {
+            return const_iterator(mItems.end());
+        }
+
+        const_iterator cend() const noexcept {
+            return const_iterator(mItems.cend());
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return mItems.empty();
+        }
+
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return mItems.size();
+        }
+
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return mItems.capacity();
+        }
+
+        void reserve(size_type count) {
+            mItems.reserve(count);
+        }
+
+        void shrink_to_fit() {
+            mItems.shrink_to_fit();
+        }
+
+        void clear() noexcept {
+            mItems.clear();
+        }
+
+        iterator lower_bound(const Key& key) {
+            return iterator(
+                std::lower_bound(mItems.begin(), mItems.end(), key, [&](const stored_type& item, const Key& k) {
+                    return mCompare(item.key(), k);
+                }));
+        }
+
+        const_iterator lower_bound(const Key& key) const {
+            return const_cast<Map*>(this)->lower_bound(key);
+        }
+
+        iterator upper_bound(const Key& key) {
+            return iterator(
+                std::upper_bound(mItems.begin(), mItems.end(), key, [&](const Key& k, const stored_type& item) {
+                    return mCompare(k, item.key());
+                }));
+        }
+
+        const_iterator upper_bound(const Key& key) const {
+            return const_cast<Map*>(this)->upper_bound(key);
+        }
+
+        iterator find(const Key& key) {
+            auto it = lower_bound(key);
+            if (isKeyAt(it, key)) {
+                return it;
+            }
+            return end();
+        }
+
+        const_iterator find(const Key& key) const {
+            return const_cast<Map*>(this)->find(key);
+        }
+
+        [[nodiscard]]
+        size_type count(const Key& key) const {
+            return find(key) != end() ? 1 : 0;
+        }
+
+        std::pair<iterator, bool> insert(const value_type& value) {
+            return try_emplace(value.first, value.second);
+        }
+
+        std::pair<iterator, bool> insert(value_type&& value) {
+            // the key is const; only the value can be moved.
+            return try_emplace(value.first, std::move(value.second));
+        }
+
+
+        /**
+         * Appends the range and sorts once, instead of shifting the tail for each element.
+         */
+        template<typename InputIterator>
+        void insert(InputIterator first, InputIterator last) {
+            mItems.insert(mItems.end(), first, last);
+            sortUnique();
+        }
+
+        void insert(std::initializer_list<value_type> init) {
+            insert(init.begin(), init.end());
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> emplace(Args&&... args) {
+            return insertStored(stored_type(std::in_place, std::forward<Args>(args)...));
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+            auto it = lower_bound(key);
+            if (isKeyAt(it, key)) {
+                return { it, false };
+            }
+            return { iterator(mItems.emplace(it.base(), std::in_place, std::piecewise_construct,
+                                             std::forward_as_tuple(key),
+                                             std::forward_as_tuple(std::forward<Args>(args)...))), true };
+        }
+
+        template<typename... Args>
+        std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+            auto it = lower_bound(key);
+            if (isKeyAt(it, key)) {
+                return { it, false };
+            }
+            return { iterator(mItems.emplace(it.base(), std::in_place, std::piecewise_construct,
+                                             std::forward_as_tuple(std::move(key)),
+                                             std::forward_as_tuple(std::forward<Args>(args)...))), true };
+        }
+
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value) {
+            auto result = try_emplace(key, std::forward<M>(value));
+            if (!result.second) {
+                result.first->second = std::forward<M>(value);
+            }
+            return result;
+        }
+
+        template<typename M>
+        std::pair<iterator, bool> insert_or_assign(Key&& key, M&& value) {
+            auto result = try_emplace(std::move(key), std::forward<M>(value));
+            if (!result.second) {
+                result.first->second = std::forward<M>(value);
+            }
+            return result;
+        }
+
+        Value& operator[](const Key& key) {
+            return try_emplace(key).first->second;
+        }
+
+        Value& operator[](Key&& key) {
+            return try_emplace(std::move(key)).first->second;
+        }
+
+        Value& at(const Key& key) {
+            auto it = find(key);
+            if (it == end()) {
+                throw std::out_of_range("no such key");
+            }
+            return it->second;
+        }
+
+        const Value& at(const Key& key) const {
+            return const_cast<Map*>(this)->at(key);
+        }
+
+        iterator erase(const_iterator position) {
+            return iterator(mItems.erase(position.base()));
+        }
+
+        iterator erase(const_iterator first, const_iterator last) {
+            return iterator(mItems.erase(first.base(), last.base()));
+        }
+
+        size_type erase(const Key& key) {
+            auto it = find(key);
+            if (it == end()) {
+                return 0;
+            }
+            mItems.erase(it.base());
+            return 1;
+        }
+
+        void swap(Map& other) noexcept {
+            using std::swap;
+            swap(mItems, other.mItems);
+            swap(mCompare, other.mCompare);
+        }
+
+        key_compare key_comp() const {
+            return mCompare;
+        }
+
+        friend bool operator==(const Map& lhs, const Map& rhs) {
+            return lhs.mItems == rhs.mItems;
+        }
+
+    private:
+        container_type mItems;
+        [[no_unique_address]] Compare mCompare;
+
+        std::pair<iterator, bool> insertStored(stored_type&& value) {
+            auto it = lower_bound(value.key());
+            if (isKeyAt(it, value.key())) {
+                return { it, false };
+            }
+            return { iterator(mItems.insert(it.base(), std::move(value))), true };
+        }
+
+        bool isKeyAt(const_iterator it, const Key& key) const {
+            return it != end() && !mCompare(key, it->first);
+        }
+
+        /**
+         * Sorts by key keeping the first of the equal keys, as repeated insert does.
+         */
+        void sortUnique() {
+            std::stable_sort(mItems.begin(), mItems.end(), [&](const stored_type& lhs, const stored_type& rhs) {
+                return mCompare(lhs.key(), rhs.key());
+            });
+            mItems.erase(std::unique(mItems.begin(), mItems.end(), [&](const stored_type& lhs, const stored_type& rhs) {
+                return !mCompare(lhs.key(), rhs.key());
+            }), mItems.end());
+        }
+    };
+}
@@ -0,0 +1,73 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace aui::detail {
+    /**
+     * Storage of a key-value element of the flat maps, which move their elements between slots.
+     *
+     * The element is exposed as std::pair<const Key, Value>, so keys can't be modified in place. Moving it with its
+     * key is done through the mutableValue member, as libc++ __value_type and abseil map slots do. Both members are
+     * standard layout pairs of layout compatible types then, which is their common initial sequence. Otherwise, the
+     * element is moved as std::pair<const Key, Value>, i.e., the key is copied.
+     */
+    template<typename Key, typename Value>
+    union MapSlot {
+        using value_type = std::pair<const Key, Value>;
+        using mutable_value_type = std::pair<Key, Value>;
+
+        static constexpr bool MUTABLE_KEYS =
+            std::is_standard_layout_v<value_type> && std::is_standard_layout_v<mutable_value_type>;
+
+        static constexpr bool NOTHROW_MOVE = MUTABLE_KEYS ? std::is_nothrow_move_constructible_v<mutable_value_type>
+                                                          : std::is_nothrow_move_constructible_v<value_type>;
+
+        value_type value;
+        mutable_value_type mutableValue;
+
+        MapSlot() noexcept {}
+        ~MapSlot() {}
+
+        template<typename... Args>
+        void construct(Args&&... args) {
+            new (std::addressof(value)) value_type(std::forward<Args>(args)...);
+        }
+
+        /**
+         * Constructs the element moving it from other, which is left moved from.
+         */
+        void constructMoving(MapSlot& other) noexcept(NOTHROW_MOVE) {
+            if constexpr (MUTABLE_KEYS) {
+                new (std::addressof(mutableValue)) mutable_value_type(std::move(other.mutableValue));
+            } else {
+                construct(std::move(other.value));
+            }
+        }
+
+        void destroy() noexcept {
+            value.~value_type();
+        }
+
+        /**
+         * Moves the element from src to uninitialized dst and destroys src.
+         */
+        static void relocate(MapSlot* dst, MapSlot* src) noexcept(NOTHROW_MOVE) {
+            dst->constructMoving(*src);
+            src->destroy();
+        }
+    };
+}
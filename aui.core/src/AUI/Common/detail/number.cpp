@@ -0,0 +1,254 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <string>
+#include <fmt/format.h>
+#include "number.h"
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace {
+
+bool isDigit(char16_t c) noexcept {
+    return c >= u'0' && c <= u'9';
+}
+
+unsigned digitValue(char16_t c) noexcept {
+    if (isDigit(c)) {
+        return c - u'0';
+    }
+    if (c >= u'a' && c <= u'z') {
+        return c - u'a' + 10;
+    }
+    if (c >= u'A' && c <= u'Z') {
+        return c - u'A' + 10;
+    }
+    return std::numeric_limits<unsigned>::max();
+}
+
+/**
+ * @brief Powers of 10 exactly representable as double.
+ */
+constexpr double EXACT_POW10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+/**
+ * @brief Max power of 10 exactly representable as T.
+ */
+template<typename T>
+constexpr int MAX_EXACT_POW10 = std::is_same_v<T, float> ? 10 : 22;
+
+/**
+ * @brief Correctly rounded conversion of already validated [first, last), for the inputs the fast path can't handle.
+ */
+template<typename T>
+std::errc parseSlow(const char16_t* first, const char16_t* last, T& value) noexcept {
+    // the input consists of ASCII characters; narrowing is lossless.
+    char stackBuffer[64];
+    std::string heapBuffer;
+    char* buffer = stackBuffer;
+    auto length = std::size_t(last - first);
+    if (length >= std::size(stackBuffer)) {
+        heapBuffer.resize(length);
+        buffer = heapBuffer.data();
+    }
+    std::copy(first, last, buffer);
+    buffer[length] = '\0';
+#if defined(__cpp_lib_to_chars)
+    return std::from_chars(buffer, buffer + length, value).ec;
+#else
+    // floating point std::from_chars is not available on this standard library. The input never has locale specific
+    // characters except the decimal point, which is '.' unless the application changes LC_NUMERIC.
+    errno = 0;
+    if constexpr (std::is_same_v<T, float>) {
+        value = std::strtof(buffer, nullptr);
+    } else {
+        value = std::strtod(buffer, nullptr);
+    }
+    return errno == ERANGE ? std::errc::result_out_of_range : std::errc{};
+#endif
+}
+
+template<typename Char>
+Char* formatFloating(Char* dst, double value) noexcept {
+    auto* end = fmt::format_to(dst, "{:.6f}", value);
+    if (std::find(dst, end, Char('.')) != end) {
+        while (end[-1] == Char('0')) {
+            --end;
+        }
+        if (end[-1] == Char('.')) {
+            --end;
+        }
+    }
+    return end;
+}
+
+template<typename T>
+aui::detail::number::FromCharsResult parseFloating(const char16_t* first, const char16_t* last, T& value) noexcept {
+    const auto* p = first;
+    bool negative = false;
+    if (p != last && *p == u'-') {
+        negative = true;
+        ++p;
+    }
+
+    // up to 19 significant digits fit std::uint64_t.
+    constexpr int MAX_MANTISSA_DIGITS = 19;
+    std::uint64_t mantissa = 0;
+    int mantissaDigits = 0;
+    int exponent = 0;
+    bool truncated = false;
+    const auto* digitsBegin = p;
+    auto readDigits = [&](int exponentPerDigit, int exponentPerExtraDigit) {
+        if (mantissa == 0) {
+            // leading zeros
+            for (; p != last && *p == u'0'; ++p) {
+                exponent += exponentPerDigit;
+            }
+        }
+        for (; p != last && isDigit(*p); ++p) {
+            if (mantissaDigits < MAX_MANTISSA_DIGITS) {
+                mantissa = mantissa * 10 + (*p - u'0');
+                ++mantissaDigits;
+                exponent += exponentPerDigit;
+            } else {
+                truncated |= *p != u'0';
+                exponent += exponentPerExtraDigit;
+            }
+        }
+    };
+    readDigits(0, 1);
+    bool anyDigits = p != digitsBegin;
+    if (p != last && *p == u'.') {
+        ++p;
+        const auto* fractionBegin = p;
+        readDigits(-1, 0);
+        anyDigits |= p != fractionBegin;
+    }
+    if (!anyDigits) {
+        return { first, std::errc::invalid_argument };
+    }
+    if (p != last && (*p == u'e' || *p == u'E')) {
+        // the exponent is a part of the number only if it has digits.
+        const auto* e = p + 1;
+        bool negativeExponent = false;
+        if (e != last && (*e == u'+' || *e == u'-')) {
+            negativeExponent = *e == u'-';
+            ++e;
+        }
+        if (e != last && isDigit(*e)) {
+            int explicitExponent = 0;
+            for (; e != last && isDigit(*e); ++e) {
+                if (explicitExponent < 100000) {
+                    explicitExponent = explicitExponent * 10 + (*e - u'0');
+                }
+            }
+            exponent += negativeExponent ? -explicitExponent : explicitExponent;
+            p = e;
+        }
+    }
+
+    if (mantissa == 0) {
+        value = negative ? -T(0) : T(0);
+        return { p, {} };
+    }
+
+    // Clinger's fast path: both the mantissa and the power of 10 are exactly representable in T, so a single
+    // multiplication or division is correctly rounded.
+    if (!truncated && mantissa <= (std::uint64_t(1) << std::numeric_limits<T>::digits) &&
+        exponent >= -MAX_EXACT_POW10<T> && exponent <= MAX_EXACT_POW10<T>) {
+        auto result = T(mantissa);
+        result = exponent < 0 ? result / T(EXACT_POW10[-exponent]) : result * T(EXACT_POW10[exponent]);
+        value = negative ? -result : result;
+        return { p, {} };
+    }
+
+    T result = 0;
+    if (auto ec = parseSlow(first, p, result); ec != std::errc{}) {
+        return { p, ec };
+    }
+    value = result;
+    return { p, {} };
+}
+
+}
+
+char* aui::detail::number::toChars(char* dst, double value) noexcept {
+    return formatFloating(dst, value);
+}
+
+char16_t* aui::detail::number::toChars(char16_t* dst, double value) noexcept {
+    char buffer[MAX_FLOATING_LENGTH];
+    return std::copy(buffer, formatFloating(buffer, value), dst);
+}
+
+aui::detail::number::FromCharsResult aui::detail::number::parseUnsigned(const char16_t* first, const char16_t* last,
+                                                                        std::uint64_t& value, unsigned base) noexcept {
+    std::uint64_t result = 0;
+    const auto* p = first;
+    if (base == 10) {
+        // 19 digits always fit; check overflow only past them.
+        constexpr std::size_t SAFE_DIGITS = 19;
+        const auto* safeEnd = std::size_t(last - p) > SAFE_DIGITS ? p + SAFE_DIGITS : last;
+        for (; p != safeEnd && isDigit(*p); ++p) {
+            result = result * 10 + (*p - u'0');
+        }
+        if (p == first) {
+            return { first, std::errc::invalid_argument };
+        }
+        if (p == last || !isDigit(*p)) {
+            value = result;
+            return { p, {} };
+        }
+    }
+
+    constexpr auto MAX = std::numeric_limits<std::uint64_t>::max();
+    const auto maxQuotient = MAX / base;
+    const auto maxRemainder = MAX % base;
+    bool overflow = false;
+    for (; p != last; ++p) {
+        auto digit = digitValue(*p);
+        if (digit >= base) {
+            break;
+        }
+        if (result > maxQuotient || (result == maxQuotient && digit > maxRemainder)) {
+            overflow = true;
+            continue;
+        }
+        result = result * base + digit;
+    }
+    if (p == first) {
+        return { first, std::errc::invalid_argument };
+    }
+    if (overflow) {
+        return { p, std::errc::result_out_of_range };
+    }
+    value = result;
+    return { p, {} };
+}
+
+aui::detail::number::FromCharsResult aui::detail::number::fromChars(const char16_t* first, const char16_t* last,
+                                                                    double& value) noexcept {
+    return parseFloating(first, last, value);
+}
+
+aui::detail::number::FromCharsResult aui::detail::number::fromChars(const char16_t* first, const char16_t* last,
+                                                                    float& value) noexcept {
+    // parsed as float directly; narrowing a parsed double would round twice.
+    return parseFloating(first, last, value);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
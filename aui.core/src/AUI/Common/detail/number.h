@@ -0,0 +1,203 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#include <AUI/Core.h>
+
+/**
+ * @brief Number formatting and parsing used by AString.
+ * @details
+ * std::to_chars/std::from_chars counterparts working on char16_t (and char) buffers directly, so numbers are written to
+ * and read from strings without temporaries.
+ *
+ * Floating point numbers are formatted in fixed notation with at most 6 digits after the point, trailing zeros
+ * stripped, which is how AString::number has always formatted them.
+ */
+namespace aui::detail::number {
+
+/**
+ * @brief Max count of code units toChars writes for an integer in base 10.
+ */
+constexpr std::size_t MAX_INTEGER_LENGTH = 20;
+
+/**
+ * @brief Max count of code units toChars writes for an integer in any base.
+ * @details
+ * A 64-bit value in base 2 with a sign.
+ */
+constexpr std::size_t MAX_INTEGER_LENGTH_ANY_BASE = 64 + 1;
+
+/**
+ * @brief Max count of code units toChars writes for a floating point number.
+ * @details
+ * std::numeric_limits<double>::max() has 309 digits before the point.
+ */
+constexpr std::size_t MAX_FLOATING_LENGTH = 320;
+
+struct FromCharsResult {
+    const char16_t* ptr;
+    std::errc ec;
+};
+
+inline constexpr char DIGIT_PAIRS[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+inline constexpr std::uint64_t POW10[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+    10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL,
+};
+
+constexpr unsigned countDigits(std::uint64_t value) noexcept {
+    // setting the lowest bit never changes the count of digits, but makes 0 count as 1 digit.
+    value |= 1;
+    // log10(2) ~ 1233 / 4096
+    unsigned approximation = (unsigned(std::bit_width(value)) * 1233) >> 12;
+    return approximation + 1 - unsigned(value < POW10[approximation]);
+}
+
+/**
+ * @brief Writes value in the base (2..36) to dst.
+ * @details
+ * dst must have room for MAX_INTEGER_LENGTH code units in base 10, MAX_INTEGER_LENGTH_ANY_BASE otherwise.
+ * @return end of the written digits.
+ */
+template<typename Char>
+Char* formatUnsigned(Char* dst, std::uint64_t value, unsigned base = 10) noexcept {
+    if (base != 10) {
+        Char buffer[64];
+        auto* p = std::end(buffer);
+        do {
+            auto digit = unsigned(value % base);
+            *--p = Char(digit < 10 ? '0' + digit : 'a' + digit - 10);
+            value /= base;
+        } while (value != 0);
+        return std::copy(p, std::end(buffer), dst);
+    }
+    auto* end = dst + countDigits(value);
+    auto* p = end;
+    while (value >= 100) {
+        auto pair = unsigned(value % 100) * 2;
+        value /= 100;
+        *--p = Char(DIGIT_PAIRS[pair + 1]);
+        *--p = Char(DIGIT_PAIRS[pair]);
+    }
+    if (value >= 10) {
+        auto pair = unsigned(value) * 2;
+        *--p = Char(DIGIT_PAIRS[pair + 1]);
+        *--p = Char(DIGIT_PAIRS[pair]);
+    } else {
+        *--p = Char('0' + value);
+    }
+    return end;
+}
+
+/**
+ * @brief Writes value in the base (2..36) to dst.
+ * @details
+ * dst must have room for MAX_INTEGER_LENGTH code units in base 10, MAX_INTEGER_LENGTH_ANY_BASE otherwise.
+ * @return end of the written characters.
+ */
+template<typename Char, std::integral T>
+Char* toChars(Char* dst, T value, unsigned base = 10) noexcept {
+    if constexpr (std::is_signed_v<T>) {
+        if (value < 0) {
+            *dst++ = Char('-');
+            return formatUnsigned(dst, std::uint64_t(0) - std::uint64_t(value), base);
+        }
+    }
+    return formatUnsigned(dst, std::uint64_t(value), base);
+}
+
+/**
+ * @brief Writes value to dst, which must have room for MAX_FLOATING_LENGTH code units.
+ * @return end of the written characters.
+ */
+API_AUI_CORE char* toChars(char* dst, double value) noexcept;
+
+/**
+ * @copydoc toChars(char*, double)
+ */
+API_AUI_CORE char16_t* toChars(char16_t* dst, double value) noexcept;
+
+/**
+ * @brief Parses digits of [first, last) in the base (2..36), like std::from_chars for std::uint64_t.
+ */
+API_AUI_CORE FromCharsResult parseUnsigned(const char16_t* first, const char16_t* last, std::uint64_t& value,
+                                           unsigned base = 10) noexcept;
+
+/**
+ * @brief Parses an integer, like std::from_chars.
+ * @details
+ * Accepts optional minus sign (for signed types) followed by digits in the base. On error, value is not modified; ec
+ * is std::errc::invalid_argument if there are no digits and std::errc::result_out_of_range if the number does not fit
+ * T.
+ */
+template<std::integral T>
+requires (!std::is_same_v<T, bool>)
+FromCharsResult fromChars(const char16_t* first, const char16_t* last, T& value, unsigned base = 10) noexcept {
+    bool negative = false;
+    const auto* digits = first;
+    if constexpr (std::is_signed_v<T>) {
+        if (digits != last && *digits == u'-') {
+            negative = true;
+            ++digits;
+        }
+    }
+    std::uint64_t magnitude = 0;
+    auto result = parseUnsigned(digits, last, magnitude, base);
+    if (result.ec != std::errc{}) {
+        return result.ec == std::errc::invalid_argument ? FromCharsResult{ first, result.ec } : result;
+    }
+    auto limit = std::uint64_t(std::numeric_limits<T>::max()) + unsigned(negative);
+    if (magnitude > limit) {
+        return { result.ptr, std::errc::result_out_of_range };
+    }
+    using Unsigned = std::make_unsigned_t<T>;
+    value = negative ? T(Unsigned(0) - Unsigned(magnitude)) : T(magnitude);
+    return result;
+}
+
+/**
+ * @brief Parses a floating point number, like std::from_chars.
+ * @details
+ * Accepts optional minus sign, digits with optional decimal point and optional exponent (<code>1.5e-3</code>). At least
+ * one digit is required.
+ */
+API_AUI_CORE FromCharsResult fromChars(const char16_t* first, const char16_t* last, double& value) noexcept;
+
+/**
+ * @copydoc fromChars(const char16_t*, const char16_t*, double&)
+ * @details
+ * The number is rounded to float once, as std::from_chars for float does.
+ */
+API_AUI_CORE FromCharsResult fromChars(const char16_t* first, const char16_t* last, float& value) noexcept;
+
+}
@@ -0,0 +1,180 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include "search.h"
+#include "simd.h"
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace {
+
+/*
+ * Block primitives. Each implementation defines:
+ *
+ * LANES            - count of code units compared per step;
+ * broadcast(c)     - makes a vector of LANES copies of c;
+ * equalMask(src,v) - compares LANES code units of src with v; returns a mask with one bit per equal code unit. The
+ *                    bit of the i-th code unit is i * LANE_BITS.
+ */
+
+#if AUI_SIMD_AVX2
+
+constexpr std::size_t LANES = 16;
+constexpr std::size_t LANE_BITS = 2;
+
+__m256i broadcast(char16_t c) noexcept {
+    return _mm256_set1_epi16(static_cast<short>(c));
+}
+
+std::uint64_t equalMask(const char16_t* src, __m256i v) noexcept {
+    auto eq = _mm256_cmpeq_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src)), v);
+    // movemask produces 2 bits per code unit; keep the lower one.
+    return std::uint32_t(_mm256_movemask_epi8(eq)) & 0x5555'5555U;
+}
+
+#elif AUI_SIMD_SSE2
+
+constexpr std::size_t LANES = 8;
+constexpr std::size_t LANE_BITS = 2;
+
+__m128i broadcast(char16_t c) noexcept {
+    return _mm_set1_epi16(static_cast<short>(c));
+}
+
+std::uint64_t equalMask(const char16_t* src, __m128i v) noexcept {
+    auto eq = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), v);
+    // movemask produces 2 bits per code unit; keep the lower one.
+    return std::uint32_t(_mm_movemask_epi8(eq)) & 0x5555U;
+}
+
+#elif AUI_SIMD_NEON
+
+constexpr std::size_t LANES = 8;
+constexpr std::size_t LANE_BITS = 8;
+
+uint16x8_t broadcast(char16_t c) noexcept {
+    return vdupq_n_u16(c);
+}
+
+std::uint64_t equalMask(const char16_t* src, uint16x8_t v) noexcept {
+    auto eq = vceqq_u16(vld1q_u16(reinterpret_cast<const std::uint16_t*>(src)), v);
+    // narrowing shift packs the mask to 8 bits per code unit; keep the lowest one.
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(eq, 4)), 0) & 0x0101'0101'0101'0101ULL;
+}
+
+#else
+
+constexpr std::size_t LANES = 1;
+constexpr std::size_t LANE_BITS = 1;
+
+char16_t broadcast(char16_t c) noexcept {
+    return c;
+}
+
+std::uint64_t equalMask(const char16_t* src, char16_t v) noexcept {
+    return *src == v;
+}
+
+#endif
+
+bool tailEquals(const char16_t* candidate, std::u16string_view needle) noexcept {
+    // the first and the last code units are already compared.
+    return std::memcmp(candidate + 1, needle.data() + 1, (needle.size() - 2) * sizeof(char16_t)) == 0;
+}
+
+}
+
+std::size_t aui::detail::search::find(std::u16string_view haystack, char16_t c, std::size_t offset) noexcept {
+    if (offset >= haystack.size()) {
+        return NPOS;
+    }
+    const auto* begin = haystack.data();
+    const auto* end = begin + haystack.size();
+    const auto* src = begin + offset;
+    auto v = broadcast(c);
+    for (; std::size_t(end - src) >= LANES; src += LANES) {
+        if (auto mask = equalMask(src, v)) {
+            return (src - begin) + std::countr_zero(mask) / LANE_BITS;
+        }
+    }
+    for (; src != end; ++src) {
+        if (*src == c) {
+            return src - begin;
+        }
+    }
+    return NPOS;
+}
+
+std::size_t aui::detail::search::find(std::u16string_view haystack, std::u16string_view needle, std::size_t offset) noexcept {
+    if (needle.size() <= 1) {
+        if (needle.empty()) {
+            return offset <= haystack.size() ? offset : NPOS;
+        }
+        return find(haystack, needle.front(), offset);
+    }
+    if (offset > haystack.size() || haystack.size() - offset < needle.size()) {
+        return NPOS;
+    }
+
+    const auto* src = haystack.data();
+    // candidate positions are [offset; candidatesEnd).
+    const std::size_t candidatesEnd = haystack.size() - needle.size() + 1;
+    const std::size_t lastOffset = needle.size() - 1;
+    auto first = broadcast(needle.front());
+    auto last = broadcast(needle.back());
+
+    std::size_t i = offset;
+    for (; candidatesEnd - i >= LANES; i += LANES) {
+        auto mask = equalMask(src + i, first) & equalMask(src + i + lastOffset, last);
+        for (; mask != 0; mask &= mask - 1) {
+            auto candidate = i + std::countr_zero(mask) / LANE_BITS;
+            if (tailEquals(src + candidate, needle)) {
+                return candidate;
+            }
+        }
+    }
+    for (; i < candidatesEnd; ++i) {
+        if (src[i] == needle.front() && src[i + lastOffset] == needle.back() && tailEquals(src + i, needle)) {
+            return i;
+        }
+    }
+    return NPOS;
+}
+
+std::size_t aui::detail::search::count(std::u16string_view haystack, char16_t c) noexcept {
+    const auto* src = haystack.data();
+    const auto* end = src + haystack.size();
+    auto v = broadcast(c);
+    std::size_t result = 0;
+    for (; std::size_t(end - src) >= LANES; src += LANES) {
+        result += std::popcount(equalMask(src, v));
+    }
+    for (; src != end; ++src) {
+        result += *src == c;
+    }
+    return result;
+}
+
+std::size_t aui::detail::search::count(std::u16string_view haystack, std::u16string_view needle) noexcept {
+    if (needle.empty()) {
+        return 0;
+    }
+    std::size_t result = 0;
+    for (auto i = find(haystack, needle); i != NPOS; i = find(haystack, needle, i + needle.size())) {
+        ++result;
+    }
+    return result;
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
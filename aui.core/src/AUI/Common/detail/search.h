@@ -0,0 +1,52 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <AUI/Core.h>
+
+/**
+ * @brief UTF-16 code unit search used by AString.
+ * @details
+ * Compares 8 (SSE2, NEON) or 16 (AVX2) code units per step. Substring search compares the first and the last code units
+ * of the needle against two blocks of the haystack at once and verifies the remaining code units of the candidates
+ * only, so it rarely touches the needle for natural text.
+ *
+ * All functions follow std::u16string_view::find semantics and return NPOS if nothing is found.
+ */
+namespace aui::detail::search {
+
+constexpr std::size_t NPOS = std::u16string_view::npos;
+
+/**
+ * @return index of the first occurrence of c in haystack at or after offset.
+ */
+API_AUI_CORE std::size_t find(std::u16string_view haystack, char16_t c, std::size_t offset = 0) noexcept;
+
+/**
+ * @return index of the first occurrence of needle in haystack at or after offset.
+ */
+API_AUI_CORE std::size_t find(std::u16string_view haystack, std::u16string_view needle, std::size_t offset = 0) noexcept;
+
+/**
+ * @return count of occurrences of c in haystack.
+ */
+API_AUI_CORE std::size_t count(std::u16string_view haystack, char16_t c) noexcept;
+
+/**
+ * @return count of non-overlapping occurrences of needle in haystack, as found by consecutive find calls. Zero for an
+ *         empty needle.
+ */
+API_AUI_CORE std::size_t count(std::u16string_view haystack, std::u16string_view needle) noexcept;
+
+}
@@ -0,0 +1,34 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+/*
+ * Instruction set selection for the string primitives in this directory. Exactly one of AUI_SIMD_AVX2, AUI_SIMD_SSE2
+ * and AUI_SIMD_NEON is defined to 1 and the matching intrinsics header is included, or none of them if the target has
+ * no suitable instruction set; the portable implementations are used then.
+ *
+ * The selection is made at compile time only: SSE2 and NEON are baseline for x86_64 and aarch64, AVX2 is used when the
+ * compiler is allowed to emit it (-mavx2, -march=native, /arch:AVX2).
+ *
+ * Include it only from translation units.
+ */
+
+#if defined(__AVX2__)
+#define AUI_SIMD_AVX2 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUI_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define AUI_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
@@ -0,0 +1,392 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <bit>
+#include <cstdint>
+#include "utf.h"
+#include "simd.h"
+
+// utf8 stuff has a lot of magic
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+namespace {
+
+/*
+ * Block primitives. Each implementation defines:
+ *
+ * BLOCK                     - count of code units processed per step;
+ * widenAsciiPrefix(src,dst) - widens BLOCK bytes of src to dst; returns count of leading ASCII bytes;
+ * narrowAsciiPrefix(src,dst)- narrows BLOCK code units of src to dst; returns count of leading ASCII code units;
+ * encodedLength(src)        - returns count of UTF-8 bytes of BLOCK code units of src, or NO_LENGTH if the block
+ *                             contains surrogates.
+ *
+ * widenAsciiPrefix and narrowAsciiPrefix write the whole block regardless of the returned value; the caller guarantees
+ * dst has room for it and overwrites the garbage past the ASCII prefix.
+ */
+constexpr std::size_t NO_LENGTH = std::size_t(-1);
+
+#if AUI_SIMD_AVX2
+
+constexpr std::size_t BLOCK = 32;
+
+std::size_t widenAsciiPrefix(const char* src, char16_t* dst) noexcept {
+    auto v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 16), _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+    auto nonAscii = std::uint32_t(_mm256_movemask_epi8(v));
+    return nonAscii == 0 ? BLOCK : std::countr_zero(nonAscii);
+}
+
+std::size_t narrowAsciiPrefix(const char16_t* src, char* dst) noexcept {
+    auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 16));
+    // packs operate on 128-bit lanes; restore the order of 64-bit quarters.
+    auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0b11'01'10'00);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), packed);
+
+    auto zero = _mm256_setzero_si256();
+    auto highBits = _mm256_set1_epi16(std::int16_t(0xff80));
+    auto asciiA = _mm256_cmpeq_epi16(_mm256_and_si256(a, highBits), zero);
+    auto asciiB = _mm256_cmpeq_epi16(_mm256_and_si256(b, highBits), zero);
+    auto ascii = _mm256_permute4x64_epi64(_mm256_packs_epi16(asciiA, asciiB), 0b11'01'10'00);
+    auto nonAscii = ~std::uint32_t(_mm256_movemask_epi8(ascii));
+    return nonAscii == 0 ? BLOCK : std::countr_zero(nonAscii);
+}
+
+std::size_t encodedLength(const char16_t* src) noexcept {
+    auto zero = _mm256_setzero_si256();
+    auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 16));
+    auto topBitsMask = _mm256_set1_epi16(std::int16_t(0xf800));
+    auto surrogate = _mm256_set1_epi16(std::int16_t(0xd800));
+    auto topBitsA = _mm256_and_si256(a, topBitsMask);
+    auto topBitsB = _mm256_and_si256(b, topBitsMask);
+    if (_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi16(topBitsA, surrogate), _mm256_cmpeq_epi16(topBitsB, surrogate)))) {
+        return NO_LENGTH;
+    }
+    // 3 bytes per code unit, minus 1 if < 0x80, minus 1 if < 0x800; comparison results are -1 or 0.
+    auto asciiMask = _mm256_set1_epi16(std::int16_t(0xff80));
+    auto delta = _mm256_add_epi16(
+        _mm256_add_epi16(_mm256_cmpeq_epi16(_mm256_and_si256(a, asciiMask), zero), _mm256_cmpeq_epi16(topBitsA, zero)),
+        _mm256_add_epi16(_mm256_cmpeq_epi16(_mm256_and_si256(b, asciiMask), zero), _mm256_cmpeq_epi16(topBitsB, zero)));
+    auto sum256 = _mm256_madd_epi16(delta, _mm256_set1_epi16(1));
+    auto sum = _mm_add_epi32(_mm256_castsi256_si128(sum256), _mm256_extracti128_si256(sum256, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0b01'00'11'10));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0b10'11'00'01));
+    return 3 * BLOCK + _mm_cvtsi128_si32(sum);
+}
+
+#elif AUI_SIMD_SSE2
+
+constexpr std::size_t BLOCK = 16;
+
+std::size_t widenAsciiPrefix(const char* src, char16_t* dst) noexcept {
+    auto v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    auto zero = _mm_setzero_si128();
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), _mm_unpackhi_epi8(v, zero));
+    auto nonAscii = std::uint32_t(_mm_movemask_epi8(v));
+    return nonAscii == 0 ? BLOCK : std::countr_zero(nonAscii);
+}
+
+std::size_t narrowAsciiPrefix(const char16_t* src, char* dst) noexcept {
+    auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(a, b));
+
+    auto zero = _mm_setzero_si128();
+    auto highBits = _mm_set1_epi16(std::int16_t(0xff80));
+    auto asciiA = _mm_cmpeq_epi16(_mm_and_si128(a, highBits), zero);
+    auto asciiB = _mm_cmpeq_epi16(_mm_and_si128(b, highBits), zero);
+    auto nonAscii = ~std::uint32_t(_mm_movemask_epi8(_mm_packs_epi16(asciiA, asciiB))) & 0xffff;
+    return nonAscii == 0 ? BLOCK : std::countr_zero(nonAscii);
+}
+
+std::size_t encodedLength(const char16_t* src) noexcept {
+    auto zero = _mm_setzero_si128();
+    auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+    auto topBitsMask = _mm_set1_epi16(std::int16_t(0xf800));
+    auto surrogate = _mm_set1_epi16(std::int16_t(0xd800));
+    auto topBitsA = _mm_and_si128(a, topBitsMask);
+    auto topBitsB = _mm_and_si128(b, topBitsMask);
+    if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi16(topBitsA, surrogate), _mm_cmpeq_epi16(topBitsB, surrogate)))) {
+        return NO_LENGTH;
+    }
+    // 3 bytes per code unit, minus 1 if < 0x80, minus 1 if < 0x800; comparison results are -1 or 0.
+    auto asciiMask = _mm_set1_epi16(std::int16_t(0xff80));
+    auto delta = _mm_add_epi16(
+        _mm_add_epi16(_mm_cmpeq_epi16(_mm_and_si128(a, asciiMask), zero), _mm_cmpeq_epi16(topBitsA, zero)),
+        _mm_add_epi16(_mm_cmpeq_epi16(_mm_and_si128(b, asciiMask), zero), _mm_cmpeq_epi16(topBitsB, zero)));
+    auto sum = _mm_madd_epi16(delta, _mm_set1_epi16(1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0b01'00'11'10));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, 0b10'11'00'01));
+    return 3 * BLOCK + _mm_cvtsi128_si32(sum);
+}
+
+#elif AUI_SIMD_NEON
+
+constexpr std::size_t BLOCK = 16;
+
+/**
+ * @return index of the first set byte of 16-byte mask, or BLOCK if none.
+ */
+std::size_t firstSet(uint8x16_t mask) noexcept {
+    // narrowing shift packs the mask to 4 bits per byte.
+    auto bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(mask), 4)), 0);
+    return bits == 0 ? BLOCK : std::countr_zero(bits) / 4;
+}
+
+std::size_t widenAsciiPrefix(const char* src, char16_t* dst) noexcept {
+    auto v = vld1q_u8(reinterpret_cast<const std::uint8_t*>(src));
+    vst1q_u16(reinterpret_cast<std::uint16_t*>(dst), vmovl_u8(vget_low_u8(v)));
+    vst1q_u16(reinterpret_cast<std::uint16_t*>(dst + 8), vmovl_high_u8(v));
+    return firstSet(vcgeq_u8(v, vdupq_n_u8(0x80)));
+}
+
+std::size_t narrowAsciiPrefix(const char16_t* src, char* dst) noexcept {
+    auto a = vld1q_u16(reinterpret_cast<const std::uint16_t*>(src));
+    auto b = vld1q_u16(reinterpret_cast<const std::uint16_t*>(src + 8));
+    vst1q_u8(reinterpret_cast<std::uint8_t*>(dst), vcombine_u8(vqmovn_u16(a), vqmovn_u16(b)));
+    auto limit = vdupq_n_u16(0x7f);
+    return firstSet(vcombine_u8(vmovn_u16(vcgtq_u16(a, limit)), vmovn_u16(vcgtq_u16(b, limit))));
+}
+
+std::size_t encodedLength(const char16_t* src) noexcept {
+    auto a = vld1q_u16(reinterpret_cast<const std::uint16_t*>(src));
+    auto b = vld1q_u16(reinterpret_cast<const std::uint16_t*>(src + 8));
+    auto topBitsMask = vdupq_n_u16(0xf800);
+    auto surrogate = vdupq_n_u16(0xd800);
+    if (vmaxvq_u16(vorrq_u16(vceqq_u16(vandq_u16(a, topBitsMask), surrogate),
+                             vceqq_u16(vandq_u16(b, topBitsMask), surrogate)))) {
+        return NO_LENGTH;
+    }
+    // 1 byte per code unit + 1 if >= 0x80 + 1 if >= 0x800; comparison results are 0 or 0xffff, shift them to 0 or 1.
+    auto extra = vaddq_u16(vaddq_u16(vshrq_n_u16(vcgtq_u16(a, vdupq_n_u16(0x7f)), 15),
+                                     vshrq_n_u16(vcgtq_u16(a, vdupq_n_u16(0x7ff)), 15)),
+                           vaddq_u16(vshrq_n_u16(vcgtq_u16(b, vdupq_n_u16(0x7f)), 15),
+                                     vshrq_n_u16(vcgtq_u16(b, vdupq_n_u16(0x7ff)), 15)));
+    return BLOCK + vaddvq_u16(extra);
+}
+
+#else
+
+constexpr std::size_t BLOCK = 8;
+
+std::size_t widenAsciiPrefix(const char* src, char16_t* dst) noexcept {
+    std::size_t result = BLOCK;
+    for (std::size_t i = 0; i < BLOCK; ++i) {
+        auto c = std::uint8_t(src[i]);
+        dst[i] = c;
+        if (c >= 0x80 && result == BLOCK) {
+            result = i;
+        }
+    }
+    return result;
+}
+
+std::size_t narrowAsciiPrefix(const char16_t* src, char* dst) noexcept {
+    std::size_t result = BLOCK;
+    for (std::size_t i = 0; i < BLOCK; ++i) {
+        auto c = src[i];
+        dst[i] = char(c);
+        if (c >= 0x80 && result == BLOCK) {
+            result = i;
+        }
+    }
+    return result;
+}
+
+std::size_t encodedLength(const char16_t* src) noexcept {
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < BLOCK; ++i) {
+        auto c = src[i];
+        if ((c & 0xf800) == 0xd800) {
+            return NO_LENGTH;
+        }
+        result += 1 + (c >= 0x80) + (c >= 0x800);
+    }
+    return result;
+}
+
+#endif
+
+bool isHighSurrogate(char16_t c) noexcept {
+    return (c & 0xfc00) == 0xd800;
+}
+
+bool isLowSurrogate(char16_t c) noexcept {
+    return (c & 0xfc00) == 0xdc00;
+}
+
+/**
+ * @brief Decodes a single UTF-8 sequence at src, or skips a single byte of malformed one.
+ */
+void decodeOne(const char*& src, const char* end, char16_t*& dst) noexcept {
+    auto lead = std::uint8_t(*src);
+    if (lead < 0x80) {
+        *(dst++) = lead;
+        ++src;
+        return;
+    }
+
+    if ((lead & 0b1110'0000) == 0b1100'0000 && end - src >= 2 && (std::uint8_t(src[1]) & 0b1100'0000) == 0b1000'0000) {
+        // the most common case for non-latin alphabets
+        *(dst++) = char16_t((lead & 0b1'1111) << 6 | (std::uint8_t(src[1]) & 0b11'1111));
+        src += 2;
+        return;
+    }
+
+    std::size_t continuationCount;
+    char32_t codePoint;
+    if ((lead & 0b1110'0000) == 0b1100'0000) {
+        continuationCount = 1;
+        codePoint = lead & 0b1'1111;
+    } else if ((lead & 0b1111'0000) == 0b1110'0000) {
+        continuationCount = 2;
+        codePoint = lead & 0b1111;
+    } else if ((lead & 0b1111'1000) == 0b1111'0000) {
+        continuationCount = 3;
+        codePoint = lead & 0b111;
+    } else {
+        // stray continuation byte or invalid lead byte
+        ++src;
+        return;
+    }
+
+    if (std::size_t(end - src) <= continuationCount) {
+        // truncated sequence
+        ++src;
+        return;
+    }
+    for (std::size_t i = 1; i <= continuationCount; ++i) {
+        auto c = std::uint8_t(src[i]);
+        if ((c & 0b1100'0000) != 0b1000'0000) {
+            // sequence interrupted
+            ++src;
+            return;
+        }
+        codePoint = codePoint << 6 | (c & 0b11'1111);
+    }
+    if (codePoint > 0x10ffff) {
+        ++src;
+        return;
+    }
+    src += continuationCount + 1;
+
+    if (codePoint <= 0xffff) {
+        *(dst++) = char16_t(codePoint);
+        return;
+    }
+    codePoint -= 0x10000;
+    *(dst++) = char16_t((codePoint >> 10) + 0xd800);
+    *(dst++) = char16_t((codePoint & 0x3ff) + 0xdc00);
+}
+
+/**
+ * @brief Encodes a single code point (a code unit or a surrogate pair) at src.
+ */
+void encodeOne(const char16_t*& src, const char16_t* end, char*& dst) noexcept {
+    char32_t c = *(src++);
+    if (c < 0x80) {
+        *(dst++) = char(c);
+        return;
+    }
+    if (c < 0x800) {
+        *(dst++) = char(0b1100'0000 | (c >> 6));
+        *(dst++) = char(0b1000'0000 | (c & 0b11'1111));
+        return;
+    }
+    if (isHighSurrogate(char16_t(c)) && src != end && isLowSurrogate(*src)) {
+        c = ((c - 0xd800) << 10 | (*(src++) - 0xdc00)) + 0x10000;
+        *(dst++) = char(0b1111'0000 | (c >> 18));
+        *(dst++) = char(0b1000'0000 | (c >> 12 & 0b11'1111));
+        *(dst++) = char(0b1000'0000 | (c >> 6 & 0b11'1111));
+        *(dst++) = char(0b1000'0000 | (c & 0b11'1111));
+        return;
+    }
+    *(dst++) = char(0b1110'0000 | (c >> 12));
+    *(dst++) = char(0b1000'0000 | (c >> 6 & 0b11'1111));
+    *(dst++) = char(0b1000'0000 | (c & 0b11'1111));
+}
+}
+
+std::size_t aui::detail::utf::utf8ToUtf16(std::string_view utf8, char16_t* destination) noexcept {
+    auto src = utf8.data();
+    auto end = src + utf8.size();
+    auto dst = destination;
+
+    // dst never gets ahead of src, so a whole block always fits into destination.
+    while (src != end) {
+        if (std::size_t(end - src) >= BLOCK) {
+            auto ascii = widenAsciiPrefix(src, dst);
+            src += ascii;
+            dst += ascii;
+            if (ascii == BLOCK) {
+                continue;
+            }
+        }
+        // decode the whole non-ASCII run before trying the next block.
+        do {
+            decodeOne(src, end, dst);
+        } while (src != end && std::uint8_t(*src) >= 0x80);
+    }
+    return dst - destination;
+}
+
+std::size_t aui::detail::utf::utf8Length(std::u16string_view utf16) noexcept {
+    auto src = utf16.data();
+    auto end = src + utf16.size();
+    std::size_t result = 0;
+    while (src != end) {
+        if (std::size_t(end - src) >= BLOCK) {
+            if (auto length = encodedLength(src); length != NO_LENGTH) {
+                result += length;
+                src += BLOCK;
+                continue;
+            }
+        }
+        char32_t c = *(src++);
+        if (isHighSurrogate(char16_t(c)) && src != end && isLowSurrogate(*src)) {
+            ++src;
+            result += 4;
+            continue;
+        }
+        result += 1 + (c >= 0x80) + (c >= 0x800);
+    }
+    return result;
+}
+
+std::size_t aui::detail::utf::utf16ToUtf8(std::u16string_view utf16, char* destination) noexcept {
+    auto src = utf16.data();
+    auto end = src + utf16.size();
+    auto dst = destination;
+
+    // every code unit takes at least one byte, so a whole block always fits into destination.
+    while (src != end) {
+        if (std::size_t(end - src) >= BLOCK) {
+            auto ascii = narrowAsciiPrefix(src, dst);
+            src += ascii;
+            dst += ascii;
+            if (ascii == BLOCK) {
+                continue;
+            }
+        }
+        // encode the whole non-ASCII run before trying the next block.
+        do {
+            encodeOne(src, end, dst);
+        } while (src != end && *src >= 0x80);
+    }
+    return dst - destination;
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-pro-bounds-pointer-arithmetic)
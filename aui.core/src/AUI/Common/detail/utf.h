@@ -0,0 +1,89 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <AUI/Core.h>
+
+/**
+ * @brief UTF-8 <-> UTF-16 transcoding used by AString.
+ * @details
+ * Runs of ASCII are processed by blocks of 16 (SSE2, NEON) or 32 (AVX2) code units per step; other code points are
+ * transcoded one by one. A portable 8-byte block implementation is used on other platforms.
+ */
+namespace aui::detail::utf {
+
+/**
+ * @brief Decodes UTF-8 to UTF-16.
+ * @param utf8 input.
+ * @param destination output buffer of at least utf8.size() code units (a byte never decodes to more than one code
+ *        unit).
+ * @return count of code units written.
+ * @details
+ * Malformed sequences (stray continuation bytes, truncated sequences and code points above U+10FFFF) are skipped byte by
+ * byte without producing any output. Overlong sequences are decoded as is.
+ */
+API_AUI_CORE std::size_t utf8ToUtf16(std::string_view utf8, char16_t* destination) noexcept;
+
+/**
+ * @return count of bytes utf16ToUtf8 produces for the input.
+ */
+API_AUI_CORE std::size_t utf8Length(std::u16string_view utf16) noexcept;
+
+/**
+ * @brief Encodes UTF-16 to UTF-8.
+ * @param utf16 input.
+ * @param destination output buffer of at least utf8Length(utf16) bytes.
+ * @return count of bytes written.
+ * @details
+ * Unpaired surrogates are encoded as 3-byte sequences, so they survive the round trip through utf8ToUtf16.
+ */
+API_AUI_CORE std::size_t utf16ToUtf8(std::u16string_view utf16, char* destination) noexcept;
+
+/**
+ * @brief Null-terminated UTF-8 copy of UTF-16 string for C APIs (syscalls, C libraries).
+ * @details
+ * Strings shorter than STACK_SIZE bytes are encoded right into the object, so short-lived conversions like
+ * `::stat(CString(path).c_str(), ...)` do not touch the heap.
+ */
+class CString {
+public:
+    static constexpr std::size_t STACK_SIZE = 256;
+
+    explicit CString(std::u16string_view utf16) {
+        auto length = utf8Length(utf16);
+        char* dst = mStack;
+        if (length >= STACK_SIZE) {
+            mHeap = std::make_unique<char[]>(length + 1);
+            dst = mHeap.get();
+        }
+        dst[utf16ToUtf8(utf16, dst)] = '\0';
+        mData = dst;
+    }
+
+    CString(const CString&) = delete;
+    CString& operator=(const CString&) = delete;
+
+    [[nodiscard]]
+    const char* c_str() const noexcept {
+        return mData;
+    }
+
+private:
+    char mStack[STACK_SIZE];
+    std::unique_ptr<char[]> mHeap;
+    const char* mData;
+};
+
+}   // namespace aui::detail::utf
@@ -13,12 +13,13 @@
 #include "AFileInputStream.h"
 
 #include "AUI/Common/AString.h"
+#include "AUI/Common/detail/utf.h"
 
 AFileInputStream::AFileInputStream(const AString& path) {
 #if AUI_PLATFORM_WIN
     _wfopen_s(&mFile, aui::win32::toWchar(path), L"rb");
 #else
-    mFile = fopen(path.toStdString().c_str(), "rb");
+    mFile = fopen(aui::detail::utf::CString({ path.data(), path.size() }).c_str(), "rb");
 #endif
     if (!mFile) {
         aui::impl::unix_based::lastErrorToException("unable to open {}"_format(path));
@@ -12,6 +12,7 @@
 #include "AFileOutputStream.h"
 
 #include "AUI/Common/AString.h"
+#include "AUI/Common/detail/utf.h"
 #include "AUI/Platform/ErrorToException.h"
 
 #if AUI_PLATFORM_WIN
@@ -60,7 +61,7 @@ void AFileOutputStream::open(bool append) {
 #if AUI_PLATFORM_WIN
     mFile = _wfsopen(aui::win32::toWchar(mPath), append ? L"a+b" : L"wb", _SH_DENYWR);
 #else
-    mFile = fopen(mPath.toStdString().c_str(), append ? "a+b" : "wb");
+    mFile = fopen(aui::detail::utf::CString({ mPath.data(), mPath.size() }).c_str(), append ? "a+b" : "wb");
 #endif
     if (!mFile)
     {
@@ -26,6 +26,7 @@
 #include "AUI/Util/ACleanup.h"
 #include <AUI/Traits/platform.h>
 #include <AUI/Util/kAUI.h>
+#include <AUI/Common/detail/utf.h>
 
 #ifdef WIN32
 #include <windows.h>
@@ -37,6 +38,17 @@
 #include <cstring>
 #endif
 
+#if !AUI_PLATFORM_WIN
+namespace {
+/**
+ * @return path as null-terminated UTF-8 for syscalls.
+ */
+aui::detail::utf::CString native(const AString& path) {
+    return aui::detail::utf::CString({ path.data(), path.size() });
+}
+}
+#endif
+
 APath APath::parent() const {
     auto c = ensureNonSlashEnding().rfind('/');
     if (c != NPOS) {
@@ -121,7 +133,7 @@ const APath& APath::removeFile() const {
         throw AFileNotFoundException("could not remove file " + *this + ": not exists");
     }
 #else
-    if (::remove(toStdString().c_str()) != 0) {
+    if (::remove(native(*this).c_str()) != 0) {
         aui::impl::lastErrorToException("could not remove file " + *this);
     }
 #endif
@@ -156,7 +168,7 @@ ADeque<APath> APath::listDir(AFileListFlags f) const {
 
     if (dir == INVALID_HANDLE_VALUE) {
 #else
-    DIR* dir = opendir(toStdString().c_str());
+    DIR* dir = opendir(native(*this).c_str());
     if (!dir) {
 #endif
         aui::impl::lastErrorToException("could not list " + *this);
@@ -226,7 +238,7 @@ APath APath::absolute() const {
     buf.removeBackSlashes();
     return buf;
 #else
-    auto rawPath = aui::ptr::make_unique_with_deleter(realpath(toStdString().c_str(), nullptr), free);
+    auto rawPath = aui::ptr::make_unique_with_deleter(realpath(native(*this).c_str(), nullptr), free);
     if (!rawPath) {
         aui::impl::lastErrorToException("could not find absolute file " + *this);
     }
@@ -242,7 +254,7 @@ const APath& APath::makeDir() const {
         return *this;
     }
 #else
-    if (::mkdir(toStdString().c_str(), 0755) == 0) {
+    if (::mkdir(native(*this).c_str(), 0755) == 0) {
         return *this;
     }
 #endif
@@ -291,7 +303,7 @@ struct _stat64 APath::stat() const {
 #else
 struct stat APath::stat() const {
     struct stat s = {0};
-    ::stat(toStdString().c_str(), &s);
+    ::stat(native(*this).c_str(), &s);
     return s;
 }
 #endif
@@ -455,7 +467,7 @@ void APath::move(const APath& source, const APath& destination) {
 #if AUI_PLATFORM_WIN
     if (MoveFile(aui::win32::toWchar(source.c_str()), aui::win32::toWchar(destination.c_str())) == 0) {
 #else
-    if (rename(source.toStdString().c_str(), destination.toStdString().c_str())) {
+    if (rename(native(source).c_str(), native(destination).c_str())) {
 #endif
         aui::impl::lastErrorToException(R"(could not rename "{}" to "{}")"_format(source, destination));
     }
@@ -480,7 +492,7 @@ const APath& APath::chmod(int newMode) const {
 #if AUI_PLATFORM_WIN
     if (::_wchmod(aui::win32::toWchar(*this), newMode) != 0)
 #else
-    if (::chmod(toStdString().c_str(), newMode) != 0)
+    if (::chmod(native(*this).c_str(), newMode) != 0)
 #endif
     {
         aui::impl::lastErrorToException("unable to chmod {}"_format(*this));
@@ -540,11 +552,11 @@ bool APath::isEffectivelyAccessible(AFileAccess flags) const noexcept {
     }
     return _waccess(aui::win32::toWchar(*this), wflags) == 0;
 #elif AUI_PLATFORM_LINUX
-    return euidaccess(toStdString().c_str(), int(flags)) == 0;
+    return euidaccess(native(*this).c_str(), int(flags)) == 0;
 #elif AUI_PLATFORM_ANDROID
-    return access(toStdString().c_str(), int(flags)) == 0;
+    return access(native(*this).c_str(), int(flags)) == 0;
 #elif AUI_PLATFORM_APPLE
-    return access(toStdString().c_str(), int(flags)) == 0;
+    return access(native(*this).c_str(), int(flags)) == 0;
 #elif
 #error "unimplemented"
 #endif
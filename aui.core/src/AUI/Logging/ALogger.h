@@ -21,6 +21,7 @@
 #include <fmt/format.h>
 #include <fmt/chrono.h>
 #include <AUI/Thread/AMutexWrapper.h>
+#include <AUI/Common/detail/utf.h>
 
 class AString;
 
@@ -123,6 +124,24 @@ public:
                     std::get<HeapBuffer>(mBuffer).push_back(c);
                 }
 
+                /**
+                 * @brief Appends s uninitialized bytes.
+                 * @return pointer to the appended bytes.
+                 */
+                char* grow(size_t s) {
+                    if (std::holds_alternative<StackBuffer>(mBuffer)) {
+                        auto& stack = std::get<StackBuffer>(mBuffer);
+                        if (stack.currentIterator + s <= stack.buffer + sizeof(stack.buffer)) {
+                            return std::exchange(stack.currentIterator, stack.currentIterator + s);
+                        }
+                        switchToHeap();
+                    }
+                    auto& h = std::get<HeapBuffer>(mBuffer);
+                    auto offset = h.size();
+                    h.resize(offset + s);
+                    return h.data() + offset;
+                }
+
                 void push_back(char c) { // for std::back_inserter
                     write(c);
                 }
@@ -185,7 +204,9 @@ public:
                     std::string_view stringView(t);
                     mBuffer.write(stringView.data(), stringView.size());
                 } else if constexpr(std::is_base_of_v<AString, T>) {
-                    *this << t.toStdString();
+                    // encode right into the buffer, bypassing std::string temporary
+                    std::u16string_view utf16(t.data(), t.size());
+                    aui::detail::utf::utf16ToUtf8(utf16, mBuffer.grow(aui::detail::utf::utf8Length(utf16)));
                 } else if constexpr(std::is_base_of_v<std::exception, T> && !std::is_base_of_v<AException, T>) {
                     *this << "(" << AReflect::name(&t) << ") " << t.what();
                 } else if constexpr(std::is_same_v<std::chrono::seconds, T>) {
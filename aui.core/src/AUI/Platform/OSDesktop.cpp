@@ -42,16 +42,15 @@ protected:
     void processMessagesImpl() override {
         AUI_ASSERTX(mId == std::this_thread::get_id(),
                     "AAbstractThread::processMessages() should not be called from other thread");
-        std::unique_lock lock(mMessageQueue.sync(), std::defer_lock);
-
         using namespace std::chrono;
 
         auto beginTime = system_clock::now();
-        for (std::size_t i = 0; i <= MAX_PROCESSING_ITERATIONS_PER_FRAME && !mMessageQueue.messages().empty() && lock.try_lock(); ++i)
+        for (std::size_t i = 0; i <= MAX_PROCESSING_ITERATIONS_PER_FRAME && !mMessageQueue.empty(); ++i)
         {
-            auto f = std::move(mMessageQueue.messages().front());
-            mMessageQueue.messages().pop_front();
-            lock.unlock();
+            auto f = mMessageQueue.pop();
+            if (!f) {
+                break;
+            }
             auto time = util::measureExecutionTime<microseconds>(f);
             // TODO dynamically enable/disable logging
             /*
@@ -73,10 +72,9 @@ protected:
                 }
             }
         }
-        lock.lock();
         {
             static std::size_t prevRecord = 1;
-            auto currentSize = mMessageQueue.messages().size();
+            auto currentSize = mMessageQueue.size();
             if (auto r = currentSize / 10000; r > prevRecord) {
                 prevRecord = r;
                 ALogger::warn("Performance") << currentSize << " tasks for UI thread?";
@@ -0,0 +1,213 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ALinuxEventLoop.h"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include <AUI/Platform/ErrorToException.h>
+#include <AUI/Logging/ALogger.h>
+#include <AUI/Thread/AThread.h>
+
+namespace {
+constexpr std::uint64_t EVENT_FD_ID = 0;
+constexpr auto LOG_TAG = "ALinuxEventLoop";
+}
+
+ALinuxEventLoop::ALinuxEventLoop()
+  : mEpollFd(epoll_create1(EPOLL_CLOEXEC)), mEventFd(eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+    if (mEpollFd == -1 || mEventFd == -1) {
+        aui::impl::unix_based::lastErrorToException("ALinuxEventLoop: failed to create epoll/eventfd");
+    }
+    epoll_event e {};
+    e.events = EPOLLIN;
+    e.data.u64 = EVENT_FD_ID;
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mEventFd, &e) == -1) {
+        aui::impl::unix_based::lastErrorToException("ALinuxEventLoop: epoll_ctl add failed");
+    }
+}
+
+ALinuxEventLoop::FileDescriptor::~FileDescriptor() {
+    if (fd != -1) {
+        close(fd);
+    }
+}
+
+ALinuxEventLoop::Watch::~Watch() {
+    if (ownsFd) {
+        close(fd);
+    }
+}
+
+ALinuxEventLoop::~ALinuxEventLoop() = default;
+
+void ALinuxEventLoop::notifyProcessMessages() {
+    std::uint64_t one = 1;
+    [[maybe_unused]] auto r = write(mEventFd, &one, sizeof(one));
+}
+
+void ALinuxEventLoop::loop() {
+    mRunning = true;
+    while (mRunning) {
+        iteration();
+    }
+}
+
+void ALinuxEventLoop::stop() {
+    mRunning = false;
+    notifyProcessMessages();
+}
+
+void ALinuxEventLoop::iteration(std::chrono::milliseconds timeout) {
+    AThread::processMessages();
+
+    epoll_event events[64];
+    // messages enqueued after processMessages() are signaled by the eventfd, so blocking here does not lose them.
+    int count = epoll_wait(mEpollFd, events, std::size(events), int(timeout.count()));
+    if (count < 0) {
+        if (errno == EINTR) {
+            return;
+        }
+        aui::impl::unix_based::lastErrorToException("ALinuxEventLoop: epoll_wait failed");
+    }
+
+    for (int i = 0; i < count; ++i) {
+        auto id = events[i].data.u64;
+        if (id == EVENT_FD_ID) {
+            std::uint64_t value;
+            [[maybe_unused]] auto r = read(mEventFd, &value, sizeof(value));
+            AThread::processMessages();
+            continue;
+        }
+
+        _<Watch> watch;
+        {
+            std::unique_lock lock(mSync);
+            auto it = mWatches.find(id);
+            if (it == mWatches.end()) {
+                // removed by a previous callback of this batch
+                continue;
+            }
+            watch = it->second;
+        }
+        if (watch->ownsFd) {
+            // timer; read the expiration count to rearm level triggered epoll.
+            std::uint64_t expirations;
+            if (read(watch->fd, &expirations, sizeof(expirations)) != sizeof(expirations)) {
+                continue;
+            }
+            if (!watch->repeating) {
+                removeWatch(id);
+            }
+        }
+        try {
+            watch->callback(static_cast<UnixPollEvent>(events[i].events));
+        } catch (const AException& e) {
+            ALogger::err(LOG_TAG) << "Uncaught exception in callback: " << e;
+        }
+    }
+}
+
+std::uint64_t ALinuxEventLoop::addWatch(std::uint32_t events, _<Watch> watch) {
+    std::unique_lock lock(mSync);
+    auto id = mNextId++;
+    epoll_event e {};
+    e.events = events;
+    e.data.u64 = id;
+    if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, watch->fd, &e) == -1) {
+        aui::impl::unix_based::lastErrorToException("ALinuxEventLoop: epoll_ctl add failed");
+    }
+    if (!watch->ownsFd) {
+        mIdByFd[watch->fd] = id;
+    }
+    mWatches[id] = std::move(watch);
+    return id;
+}
+
+void ALinuxEventLoop::removeWatch(std::uint64_t id) {
+    std::unique_lock lock(mSync);
+    auto it = mWatches.find(id);
+    if (it == mWatches.end()) {
+        return;
+    }
+    auto& watch = *it->second;
+    epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch.fd, nullptr);
+    if (!watch.ownsFd) {
+        mIdByFd.erase(watch.fd);
+    }
+    mWatches.erase(it);
+}
+
+void ALinuxEventLoop::registerCallback(int fd, ABitField<UnixPollEvent> flags, Callback callback) {
+    AUI_ASSERT(callback != nullptr);
+    addWatch(static_cast<std::uint32_t>(flags.value()), aui::ptr::manage(new Watch {
+        .fd = fd,
+        .ownsFd = false,
+        .repeating = true,
+        .callback = std::move(callback),
+    }));
+}
+
+void ALinuxEventLoop::unregisterCallback(int fd) {
+    std::uint64_t id;
+    {
+        std::unique_lock lock(mSync);
+        auto it = mIdByFd.find(fd);
+        if (it == mIdByFd.end()) {
+            return;
+        }
+        id = it->second;
+    }
+    removeWatch(id);
+}
+
+ALinuxEventLoop::TimerHandle ALinuxEventLoop::addTimer(std::chrono::milliseconds timeout, bool repeating,
+                                                       std::function<void()> callback) {
+    AUI_ASSERT(callback != nullptr);
+    int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd == -1) {
+        aui::impl::unix_based::lastErrorToException("ALinuxEventLoop: timerfd_create failed");
+    }
+    // zero it_value disarms timerfd, so the shortest timeout is 1ns.
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count();
+    timespec period { .tv_sec = ns / 1'000'000'000, .tv_nsec = ns % 1'000'000'000 };
+    if (ns <= 0) {
+        period = { .tv_sec = 0, .tv_nsec = 1 };
+    }
+    itimerspec spec {
+        .it_interval = repeating ? period : timespec {},
+        .it_value = period,
+    };
+    // from now on, the watch owns fd.
+    auto watch = aui::ptr::manage(new Watch {
+        .fd = fd,
+        .ownsFd = true,
+        .repeating = repeating,
+        .callback = [callback = std::move(callback)](ABitField<UnixPollEvent>) { callback(); },
+    });
+    if (timerfd_settime(fd, 0, &spec, nullptr) == -1) {
+        aui::impl::unix_based::lastErrorToException("ALinuxEventLoop: timerfd_settime failed");
+    }
+    return addWatch(EPOLLIN, std::move(watch));
+}
+
+ALinuxEventLoop::TimerHandle ALinuxEventLoop::timer(std::chrono::milliseconds timeout, std::function<void()> callback) {
+    return addTimer(timeout, true, std::move(callback));
+}
+
+ALinuxEventLoop::TimerHandle ALinuxEventLoop::enqueue(std::chrono::milliseconds timeout, std::function<void()> callback) {
+    return addTimer(timeout, false, std::move(callback));
+}
+
+void ALinuxEventLoop::removeTimer(TimerHandle timer) {
+    removeWatch(timer);
+}
@@ -0,0 +1,148 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <AUI/Thread/IEventLoop.h>
+#include <AUI/Thread/AMutex.h>
+#include <AUI/Common/SharedPtrTypes.h>
+#include <AUI/Platform/unix/UnixIoThread.h>
+#include <AUI/Traits/values.h>
+
+/**
+ * @brief epoll-based event loop for Linux.
+ * @ingroup core
+ * @details
+ * A single epoll set serves:
+ * - thread messages: notifyProcessMessages() writes to an eventfd;
+ * - timers: each timer is a timerfd;
+ * - arbitrary file descriptors (sockets, pipes, etc...) registered with registerCallback().
+ *
+ * Thus, a single thread serves messages, timers and IO readiness with one epoll_wait call per wakeup, without
+ * condition variables or a separate timer thread.
+ *
+ * @code{cpp}
+ * auto loop = _new<ALinuxEventLoop>();
+ * auto thread = _new<AThread>([loop] {
+ *     IEventLoop::Handle handle(loop.get());
+ *     loop->loop();
+ * });
+ * thread->start();
+ * loop->registerCallback(socketFd, UnixPollEvent::IN, [](ABitField<UnixPollEvent>) { ... });
+ * loop->timer(100ms, [] { ... });
+ * @endcode
+ *
+ * Callbacks are called on the thread running loop(). registerCallback(), unregisterCallback(), timer(), enqueue(),
+ * removeTimer(), notifyProcessMessages() and stop() can be called from any thread.
+ */
+class API_AUI_CORE ALinuxEventLoop: public IEventLoop {
+private:
+    /**
+     * @brief Closes the descriptor on destruction, so descriptors created by a throwing constructor do not leak.
+     */
+    struct FileDescriptor: aui::noncopyable {
+        int fd;
+
+        explicit FileDescriptor(int fd) noexcept: fd(fd) {}
+        ~FileDescriptor();
+
+        operator int() const noexcept {
+            return fd;
+        }
+    };
+
+    struct Watch {
+        int fd;
+
+        /**
+         * @brief fd is a timerfd created by the event loop. It is closed when the last reference to the watch is
+         * dropped, so the loop's thread never reads from a closed (or reused) fd after a concurrent removeTimer().
+         */
+        bool ownsFd;
+        bool repeating;
+        std::function<void(ABitField<UnixPollEvent>)> callback;
+
+        ~Watch();
+    };
+
+public:
+    using Callback = std::function<void(ABitField<UnixPollEvent> triggeredFlags)>;
+    using TimerHandle = std::uint64_t;
+
+    ALinuxEventLoop();
+    ~ALinuxEventLoop() override;
+
+    void notifyProcessMessages() override;
+
+    /**
+     * @brief Calls iteration() until stop() is called.
+     */
+    void loop() override;
+
+    void stop();
+
+    /**
+     * @brief Processes thread messages and waits for events (if there are no messages) once.
+     * @param timeout max time to wait for events; -1 to wait infinitely.
+     */
+    void iteration(std::chrono::milliseconds timeout = std::chrono::milliseconds(-1));
+
+    /**
+     * @brief Watches a file descriptor.
+     * @param fd file descriptor. Not owned by the event loop; unregister it before closing.
+     * @param flags events to watch for.
+     * @param callback called on the loop's thread when the descriptor is ready.
+     * @details
+     * Level triggered, like poll(): the callback is called on every iteration while the descriptor is ready.
+     */
+    void registerCallback(int fd, ABitField<UnixPollEvent> flags, Callback callback);
+    void unregisterCallback(int fd);
+
+    /**
+     * @brief Creates a repeating timer.
+     * @return handle to remove the timer with removeTimer().
+     */
+    TimerHandle timer(std::chrono::milliseconds timeout, std::function<void()> callback);
+
+    /**
+     * @brief Calls the callback once after timeout.
+     */
+    TimerHandle enqueue(std::chrono::milliseconds timeout, std::function<void()> callback);
+
+    void removeTimer(TimerHandle timer);
+
+private:
+    FileDescriptor mEpollFd;
+    FileDescriptor mEventFd;
+    std::atomic_bool mRunning = false;
+
+    AMutex mSync;
+
+    /**
+     * @brief Watched descriptors keyed by id passed to epoll as user data. Ids are not reused, so events of removed
+     * watches are ignored even if their fd number is reused by a new watch. Destroyed before the descriptors above.
+     */
+    std::unordered_map<std::uint64_t, _<Watch>> mWatches;
+    /**
+     * @brief Ids of watches registered with registerCallback(). Guarded by mSync, as mWatches.
+     */
+    std::unordered_map<int, std::uint64_t> mIdByFd;
+    std::uint64_t mNextId = 1;
+
+    std::uint64_t addWatch(std::uint32_t events, _<Watch> watch);
+    void removeWatch(std::uint64_t id);
+    TimerHandle addTimer(std::chrono::milliseconds timeout, bool repeating, std::function<void()> callback);
+};
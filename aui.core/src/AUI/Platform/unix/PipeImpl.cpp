@@ -13,6 +13,7 @@
 #include <cassert>
 #include "AUI/Common/AException.h"
 #include "AUI/IO/AIOException.h"
+#include "AUI/Thread/ABlockingSection.h"
 
 Pipe::Pipe() {
     int pipes[2];
@@ -43,6 +44,7 @@ void Pipe::closeOut() noexcept {
 
 size_t Pipe::read(char *dst, size_t size) {
     AUI_ASSERT(out() != 0);
+    ABlockingSection blocking;
     return ::read(out(), dst, size);
 }
 
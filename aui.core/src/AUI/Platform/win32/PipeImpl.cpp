@@ -13,6 +13,7 @@
 #include <AUI/Traits/strings.h>
 #include <cassert>
 #include "AUI/Common/AException.h"
+#include "AUI/Thread/ABlockingSection.h"
 #include <atomic>
 
 static std::uintptr_t nextUniqueId() noexcept {
@@ -80,6 +81,7 @@ size_t Pipe::read(char *dst, size_t size) {
     AUI_ASSERT(out() != 0);
 
     DWORD bytesRead;
+    ABlockingSection blocking;
     if (!ReadFile(out(), dst, size, &bytesRead, nullptr)) {
         throw AIOException("failed to read from pipe");
     }
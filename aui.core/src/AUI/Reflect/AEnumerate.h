@@ -18,7 +18,7 @@
 #include <array>
 #include <type_traits>
 #include <AUI/Common/AString.h>
-#include <AUI/Common/AMap.h>
+#include <AUI/Common/AFlatMap.h>
 #include <AUI/Traits/types.h>
 #include <fmt/format.h>
 
@@ -108,12 +108,12 @@ public:
      * @brief Get runtime name to enum value mapping.
      * @see byName
      */
-    static const AMap<AString, enum_t>& nameToValueMap();
+    static const AFlatMap<AString, enum_t>& nameToValueMap();
 
     /**
      * @brief Map runtime enum value to name.
      */
-    static const AMap<enum_t, AString, enum_less>& valueToNameMap();
+    static const AFlatMap<enum_t, AString, enum_less>& valueToNameMap();
 
     /**
      * @brief Map runtime name to enum value. Transforms name to uppercase as a fallback. Throws an exception if no such value.
@@ -140,15 +140,15 @@ public:
 
 private:
     template<enum_t... values>
-    static const AMap<AString, enum_t>& mapValueByName(const Values<values...>& v) {
-        static AMap<AString, enum_t> map = {
+    static const AFlatMap<AString, enum_t>& mapValueByName(const Values<values...>& v) {
+        static AFlatMap<AString, enum_t> map = {
             {valueName<values>(), values}...
         };
         return map;
     }
     template<enum_t... values>
-    static const AMap<enum_t, AString, enum_less>& mapNameByValue(const Values<values...>& v) {
-        static AMap<enum_t, AString, enum_less> map = {
+    static const AFlatMap<enum_t, AString, enum_less>& mapNameByValue(const Values<values...>& v) {
+        static AFlatMap<enum_t, AString, enum_less> map = {
             {values, valueName<values>() }...
         };
         return map;
@@ -159,7 +159,7 @@ template<typename enum_t>
 struct AEnumerateAllValues;
 
 template<typename enum_t>
-const AMap<AString, enum_t>& AEnumerate<enum_t>::nameToValueMap() {
+const AFlatMap<AString, enum_t>& AEnumerate<enum_t>::nameToValueMap() {
     static_assert(aui::is_complete<AEnumerateAllValues<enum_t>>, "AUI_ENUM_VALUES is not defined for this enum type");
     auto v = AEnumerateAllValues<enum_t>::get();
 
@@ -180,7 +180,7 @@ namespace aui::enumerate {
 }
 
 template<typename enum_t>
-const AMap<enum_t, AString, typename AEnumerate<enum_t>::enum_less>& AEnumerate<enum_t>::valueToNameMap() {
+const AFlatMap<enum_t, AString, typename AEnumerate<enum_t>::enum_less>& AEnumerate<enum_t>::valueToNameMap() {
     static_assert(aui::is_complete<AEnumerateAllValues<enum_t>>, "AUI_ENUM_VALUES is not defined for this enum type");
     auto v = AEnumerateAllValues<enum_t>::get();
 
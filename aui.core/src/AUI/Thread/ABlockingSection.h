@@ -0,0 +1,43 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+/**
+ * @brief Marks the caller thread as blocked within RAII range.
+ * @ingroup core
+ * @details
+ * Blocking primitives put this guard around the actual blocking call: AConditionVariable (and thus AFuture::wait,
+ * AThread::sleep, APipe), process pipes, ATcpSocket and ACurl::Builder::runBlocking. If the caller is a worker of an
+ * elastic AThreadPool (see AThreadPool::setElastic), the pool may start a temporary worker so the blocked one does not
+ * reduce the pool's throughput or deadlock it.
+ *
+ * Put it around your own blocking calls (3rd party blocking APIs, process waits, etc...) performed from pool tasks:
+ * @code{cpp}
+ * {
+ *     ABlockingSection blocking;
+ *     result = blockingApiCall();
+ * }
+ * @endcode
+ *
+ * Nesting is allowed. For threads that are not thread pool workers it costs a thread-local read.
+ */
+class API_AUI_CORE ABlockingSection {
+public:
+    ABlockingSection();
+    ~ABlockingSection();
+
+    ABlockingSection(const ABlockingSection&) = delete;
+    ABlockingSection& operator=(const ABlockingSection&) = delete;
+
+private:
+    bool mEntered = false;
+};
@@ -12,6 +12,7 @@
 #pragma once
 #include <condition_variable>
 #include "AThread.h"
+#include "ABlockingSection.h"
 #include "AUI/Performance/APerformanceSection.h"
 
 /**
@@ -26,6 +27,8 @@ private:
     std::condition_variable_any mImpl;
 
     struct WaitHelper {
+        ABlockingSection blocking;
+
         WaitHelper(AConditionVariable& var) {
             auto thread = AThread::current();
             std::unique_lock lock(thread->mCurrentCV.mutex);
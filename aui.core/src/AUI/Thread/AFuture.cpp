@@ -11,3 +11,108 @@
 
 #include "AFuture.h"
 #include "AAsyncHolder.h"
+
+#if AUI_COROUTINES
+#include <array>
+#include "AThreadPool.h"
+
+namespace {
+    using namespace aui::impl::future;
+
+    struct FreeFrame {
+        FreeFrame* next;
+    };
+
+    struct FrameCache {
+        struct FreeList {
+            FreeFrame* head = nullptr;
+            std::size_t count = 0;
+        };
+        std::array<FreeList, CoroutineFrameAllocator::MAX_SIZE / CoroutineFrameAllocator::GRANULARITY> freeLists;
+
+        ~FrameCache();
+    };
+
+    // frames can be freed during thread shutdown after the cache is destroyed; this flag is trivially destructible.
+    thread_local bool gFrameCacheDestroyed = false;
+
+    FrameCache::~FrameCache() {
+        gFrameCacheDestroyed = true;
+        for (auto& list : freeLists) {
+            while (list.head) {
+                ::operator delete(std::exchange(list.head, list.head->next));
+            }
+        }
+    }
+
+    FrameCache& frameCache() noexcept {
+        thread_local FrameCache cache;
+        return cache;
+    }
+
+    std::size_t sizeClass(std::size_t size) noexcept {
+        return (size + CoroutineFrameAllocator::GRANULARITY - 1) / CoroutineFrameAllocator::GRANULARITY - 1;
+    }
+}
+
+void* CoroutineFrameAllocator::allocate(std::size_t size) {
+    if (size > MAX_SIZE || gFrameCacheDestroyed) {
+        return ::operator new(size);
+    }
+    auto cls = sizeClass(size);
+    auto& list = frameCache().freeLists[cls];
+    if (list.head) {
+        list.count -= 1;
+        return std::exchange(list.head, list.head->next);
+    }
+    return ::operator new((cls + 1) * GRANULARITY);
+}
+
+void CoroutineFrameAllocator::deallocate(void* frame, std::size_t size) noexcept {
+    if (size > MAX_SIZE || gFrameCacheDestroyed) {
+        ::operator delete(frame);
+        return;
+    }
+    auto& list = frameCache().freeLists[sizeClass(size)];
+    if (list.count >= MAX_CACHED_FRAMES_PER_SIZE) {
+        ::operator delete(frame);
+        return;
+    }
+    list.head = new (frame) FreeFrame { list.head };
+    list.count += 1;
+}
+
+ResumeTarget ResumeTarget::current() {
+    if (auto worker = AThreadPool::Worker::currentWorker()) {
+        return { .pool = &worker->threadPool(), .thread = nullptr };
+    }
+    auto thread = AThread::current();
+    if (thread->getCurrentEventLoop() != nullptr) {
+        return { .pool = nullptr, .thread = std::move(thread) };
+    }
+    return {};
+}
+
+bool ResumeTarget::isCurrent() const {
+    if (pool) {
+        auto worker = AThreadPool::Worker::currentWorker();
+        return worker && &worker->threadPool() == pool;
+    }
+    if (thread) {
+        return AThread::current() == thread;
+    }
+    return true;
+}
+
+void ResumeTarget::resume(std::coroutine_handle<> handle) const {
+    if (pool) {
+        pool->run([handle] { handle.resume(); });
+        return;
+    }
+    if (thread) {
+        thread->enqueue([handle] { handle.resume(); });
+        return;
+    }
+    handle.resume();
+}
+#endif
@@ -23,16 +23,22 @@
 #include <atomic>
 #include <functional>
 #include <optional>
+#include <tuple>
 #include "AConditionVariable.h"
 #include "AMutex.h"
 #include <AUI/Common/SharedPtrTypes.h>
+#include <AUI/Common/AMoveOnlyFunction.h>
 #include <AUI/Common/AString.h>
+#include <AUI/Common/AVector.h>
 #include <AUI/Common/AException.h>
 #include <AUI/Logging/ALogger.h>
 #include <AUI/Reflect/AReflect.h>
 
 class AThreadPool;
 
+template <typename T>
+class AFuture;
+
 
 class AInvocationTargetException: public AException {
 
@@ -61,7 +67,83 @@ AUI_ENUM_FLAG(AFutureWait) {
 };
 
 
+namespace aui {
+    /**
+     * @brief Executor tag which runs AFuture continuation right on the thread that completed the input future.
+     * @ingroup core
+     * @details
+     * Suitable for cheap continuations only, as it occupies the thread which supplied the value.
+     * @see AFuture::then
+     */
+    struct inline_executor_t {
+        explicit inline_executor_t() = default;
+    };
+
+    inline constexpr inline_executor_t inline_executor{};
+}
+
 namespace aui::impl::future {
+    template<typename T>
+    struct IsFuture: std::false_type {};
+
+    template<typename T>
+    struct IsFuture<AFuture<T>>: std::true_type {
+        using value_type = T;
+    };
+
+    /**
+     * @brief Value type of the AFuture returned by AFuture::then for the continuation result type.
+     * @details
+     * Continuations returning AFuture are flattened: AFuture<AFuture<T>> becomes AFuture<T>.
+     */
+    template<typename T>
+    struct UnwrapFuture {
+        using type = T;
+    };
+
+    template<typename T>
+    struct UnwrapFuture<AFuture<T>> {
+        using type = T;
+    };
+
+    /**
+     * @brief Converts executor to a form that can be captured by a continuation.
+     * @details
+     * Thread pools are captured by pointer (they are not copyable and expected to outlive the continuation graph),
+     * everything else (i.e. _<AAbstractThread>, aui::inline_executor) by value.
+     */
+    inline AThreadPool* executorHandle(AThreadPool& pool) noexcept {
+        return &pool;
+    }
+
+    template<typename Executor>
+    std::decay_t<Executor> executorHandle(Executor&& executor) {
+        return std::forward<Executor>(executor);
+    }
+
+    inline void post(aui::inline_executor_t, AMoveOnlyFunction<void()> job) {
+        job();
+    }
+
+    inline void post(AThreadPool* pool, AMoveOnlyFunction<void()> job);
+
+    template<typename Thread>
+    void post(const _<Thread>& thread, AMoveOnlyFunction<void()> job) {
+        AUI_ASSERTX(thread != nullptr, "executor thread is null");
+        thread->enqueue(std::move(job));
+    }
+
+    /**
+     * @brief Extracts the original exception from AFuture's onError argument in order to forward it to another
+     * AFuture.
+     */
+    inline std::exception_ptr causeOf(const AException& e) {
+        if (e.causedBy()) {
+            return e.causedBy();
+        }
+        return std::make_exception_ptr(e);
+    }
+
     /**
      * This class calls cancel() and wait() methods of AFuture::Inner BEFORE AFuture::Inner destruction in order to keep
      * alive the weak reference created in AThreadPool::operator<<.
@@ -91,7 +173,7 @@ namespace aui::impl::future {
 
     template<typename T>
     struct OnSuccessCallback {
-        using type = std::function<void(const T& value)>;
+        using type = AMoveOnlyFunction<void(const T& value)>;
     };
 
     template<typename T>
@@ -107,7 +189,7 @@ namespace aui::impl::future {
 
     template<>
     struct OnSuccessCallback<void> {
-        using type = std::function<void()>;
+        using type = AMoveOnlyFunction<void()>;
     };
     template<typename Value = void>
     class Future
@@ -133,10 +215,19 @@ namespace aui::impl::future {
             AConditionVariable cv;
             TaskCallback task;
             OnSuccessCallback onSuccess;
-            std::function<void(const AException& exception)> onError;
+            AMoveOnlyFunction<void(const AException& exception)> onError;
             _<AAbstractThread> thread;
             bool cancelled = false;
 
+            /**
+             * @brief Keeps the inputs of a continuation (AFuture::then, aui::when_all, aui::when_any) alive.
+             * @details
+             * Ownership in the continuation graph goes from the dependent future to its inputs only; the inputs refer
+             * to the dependent future weakly. Thus, dropping the last reference to the resulting future cancels the
+             * whole graph. Written once before the future is shared or by the continuation itself.
+             */
+            std::shared_ptr<void> upstream;
+
             explicit Inner(std::function<Value()> task) noexcept: task(std::move(task)) {
                 if constexpr(isVoid) {
                     value = false;
@@ -259,6 +350,22 @@ namespace aui::impl::future {
                 return true;
             }
 
+            /**
+             * @brief Stores the value and calls onSuccess callback.
+             */
+            template<typename... V>
+            void supplyValue(V&&... v) noexcept {
+                std::unique_lock lock(mutex);
+                if constexpr (isVoid) {
+                    static_assert(sizeof...(V) == 0, "void future does not accept a value");
+                    value = true;
+                } else {
+                    value.emplace(std::forward<V>(v)...);
+                }
+                cv.notify_all();
+                notifyOnSuccessCallback(lock);
+            }
+
             void reportInterrupted() noexcept {
                 std::unique_lock lock(mutex);
                 interrupted = true;
@@ -347,12 +454,14 @@ namespace aui::impl::future {
             void addOnErrorCallback(Callback&& callback) {
                 if (onError) {
                     onError = [prev = std::move(onError),
-                               callback = std::forward<Callback>(callback)](const AException& v) {
+                               callback = std::forward<Callback>(callback)](const AException& v) mutable {
                         prev(v);
                         callback(v);
                     };
                 } else {
-                    onError = [callback = std::forward<Callback>(callback)](const AException& v) { callback(v); };
+                    onError = [callback = std::forward<Callback>(callback)](const AException& v) mutable {
+                        callback(v);
+                    };
                 }
             }
         };
@@ -440,6 +549,116 @@ namespace aui::impl::future {
             (*mInner)->notifyOnSuccessCallback(lock);
         }
 
+        /**
+         * @brief Calls exactly one of the callbacks when the result is available.
+         * @details
+         * Unlike pair of onSuccess and onError calls, handles the case when the future has already failed: onError is
+         * called immediately.
+         */
+        template<typename SuccessCallback, aui::invocable<const AException&> ErrorCallback>
+        void onResult(SuccessCallback&& onSuccess, ErrorCallback&& onError) const {
+            auto& inner = *mInner;
+            std::unique_lock lock(inner->mutex);
+            if (inner->hasValue()) {
+                lock.unlock();
+                inner->invokeOnSuccessCallback(std::forward<SuccessCallback>(onSuccess));
+                return;
+            }
+            if (inner->exception) {
+                lock.unlock();
+                onError(*inner->exception);
+                return;
+            }
+            inner->addOnSuccessCallback(std::forward<SuccessCallback>(onSuccess));
+            inner->addOnErrorCallback(std::forward<ErrorCallback>(onError));
+        }
+
+        /**
+         * @brief Schedules the callback onto the executor when this future completes.
+         * @param executor where to run the callback: AThreadPool&, _<AAbstractThread> (via its message queue) or
+         *        aui::inline_executor.
+         * @param callback continuation accepting const Value& (or nothing for AFuture<void>).
+         * @return future of the callback's result. If the callback returns AFuture<U>, the result is flattened to
+         *         AFuture<U>.
+         * @details
+         * Nothing waits for the dependency: the callback is posted to the executor from the completing thread, so
+         * thread pool workers are never parked, unlike calling operator* inside a pool task. Chaining then() calls and
+         * combining them with aui::when_all/aui::when_any forms a task DAG.
+         *
+         * Exception of this future (or thrown by the callback) is forwarded to the resulting future without calling
+         * the callback.
+         *
+         * The resulting future holds this future; dropping the resulting future cancels the graph behind it.
+         *
+         * @code{cpp}
+         * AFuture<AByteBuffer> download = ...;
+         * AFuture<AJson> json = download.then(AThreadPool::global(), [](const AByteBuffer& b) { return AJson::fromBuffer(b); });
+         * json.then(getThread(), [this](const AJson& j) { mView->setModel(j); });
+         * @endcode
+         */
+        template<typename Executor, typename Callback>
+        auto then(Executor&& executor, Callback&& callback) const {
+            using CallbackResult = decltype(invokeContinuation(callback, std::declval<const Inner&>()));
+            using Result = typename UnwrapFuture<CallbackResult>::type;
+            AFuture<Result> result;
+            auto& resultInner = result.inner();
+            resultInner->ptr()->upstream = mInner;
+
+            onResult(
+                [resultWeak = resultInner.weak(), input = mInner.get(),
+                 executor = executorHandle(std::forward<Executor>(executor)),
+                 callback = std::forward<Callback>(callback)](const auto&...) mutable {
+                    post(executor, [resultWeak, input, callback = std::move(callback)]() mutable {
+                        auto lock = resultWeak.lock();
+                        if (!lock) {
+                            // cancelled
+                            return;
+                        }
+                        // the result holds its input via upstream, so the input is alive too.
+                        auto& target = *lock->ptr();
+                        try {
+                            if constexpr (IsFuture<CallbackResult>::value) {
+                                auto next = invokeContinuation(callback, *input->ptr());
+                                target.upstream = next.inner();
+                                next.onResult(
+                                    [resultWeak](const auto&... v) {
+                                        if (auto r = resultWeak.lock()) {
+                                            r->ptr()->supplyValue(v...);
+                                        }
+                                    },
+                                    [resultWeak](const AException& e) {
+                                        if (auto r = resultWeak.lock()) {
+                                            r->ptr()->reportException(causeOf(e));
+                                        }
+                                    });
+                            } else if constexpr (std::is_void_v<CallbackResult>) {
+                                invokeContinuation(callback, *input->ptr());
+                                target.supplyValue();
+                            } else {
+                                target.supplyValue(invokeContinuation(callback, *input->ptr()));
+                            }
+                        } catch (...) {
+                            target.reportException();
+                        }
+                    });
+                },
+                [resultWeak = resultInner.weak()](const AException& e) {
+                    if (auto r = resultWeak.lock()) {
+                        r->ptr()->reportException(causeOf(e));
+                    }
+                });
+            return result;
+        }
+
+        /**
+         * @brief Calls the callback on the thread that completed this future.
+         * @see then(Executor&&, Callback&&)
+         */
+        template<typename Callback>
+        auto then(Callback&& callback) const {
+            return then(aui::inline_executor, std::forward<Callback>(callback));
+        }
+
         /**
          * @brief Cancels the AFuture's task.
          * @details
@@ -531,6 +750,15 @@ namespace aui::impl::future {
         }
 
     private:
+        template<typename Callback>
+        static decltype(auto) invokeContinuation(Callback& callback, const Inner& input) {
+            if constexpr (isVoid) {
+                return callback();
+            } else {
+                return callback(*input.value);
+            }
+        }
+
         void checkForSelfWait() const {
             if (!(*mInner)->hasResult() && AThread::current() == (*mInner)->thread) {
                 throw AException("self wait?");
@@ -651,11 +879,7 @@ public:
     void supplyValue(T v) const noexcept {
         auto& inner = (*super::mInner);
         AUI_ASSERTX(inner->task == nullptr, "task is already provided");
-
-        std::unique_lock lock(inner->mutex);
-        inner->value = std::move(v);
-        inner->cv.notify_all();
-        inner->notifyOnSuccessCallback(lock);
+        inner->supplyValue(std::move(v));
     }
 
     /**
@@ -803,11 +1027,7 @@ public:
     void supplyValue() const noexcept {
         auto& inner = (*super::mInner);
         AUI_ASSERTX(inner->task == nullptr, "task is already provided");
-
-        std::unique_lock lock(inner->mutex);
-        inner->value = true;
-        inner->cv.notify_all();
-        inner->notifyOnSuccessCallback(lock);
+        inner->supplyValue();
     }
 
     AFuture& operator=(std::nullptr_t) noexcept {
@@ -940,10 +1160,251 @@ void aui::impl::future::Future<Value>::Inner::wait(const _weak<CancellationWrapp
     }
 }
 
+inline void aui::impl::future::post(AThreadPool* pool, AMoveOnlyFunction<void()> job) {
+    AUI_ASSERTX(pool != nullptr, "executor thread pool is null");
+    pool->run(std::move(job));
+}
+
+namespace aui::impl::future {
+    template<typename Inputs>
+    struct WhenState {
+        Inputs inputs;
+        std::atomic_size_t remaining;
+        std::atomic_bool finished = false;
+
+        WhenState(Inputs inputs, std::size_t remaining): inputs(std::move(inputs)), remaining(remaining) {}
+    };
+
+    /**
+     * @brief Subscribes to the input future on behalf of aui::when_all / aui::when_any.
+     * @details
+     * The callbacks hold the resulting future weakly; while it is alive, its upstream (the WhenState) is alive too.
+     */
+    template<typename Input, typename Result, typename OnSuccess, typename OnError>
+    void whenSubscribe(const Input& input, const AFuture<Result>& result, OnSuccess onSuccess, OnError onError) {
+        input.onResult(
+            [resultWeak = result.inner().weak(), onSuccess = std::move(onSuccess)](const auto&...) {
+                if (auto lock = resultWeak.lock()) {
+                    onSuccess(*lock->ptr());
+                }
+            },
+            [resultWeak = result.inner().weak(), onError = std::move(onError)](const AException& e) {
+                if (auto lock = resultWeak.lock()) {
+                    onError(*lock->ptr(), e);
+                }
+            });
+    }
+}
+
+namespace aui {
+    /**
+     * @brief Creates a future which completes when all the futures complete.
+     * @ingroup core
+     * @param futures input futures.
+     * @return AFuture<AVector<T>> with values in the order of the inputs (AFuture<void> for void inputs).
+     * @details
+     * Completes from the thread which completed the last input; nothing waits. Fails with the first exception of the
+     * inputs. Chain with AFuture::then to run the next stage on a specific executor.
+     */
+    template<typename T>
+    auto when_all(AVector<AFuture<T>> futures) {
+        using Result = std::conditional_t<std::is_void_v<T>, void, AVector<T>>;
+        using State = impl::future::WhenState<AVector<AFuture<T>>>;
+        AFuture<Result> result;
+        if (futures.empty()) {
+            if constexpr (std::is_void_v<T>) {
+                result.supplyValue();
+            } else {
+                result.supplyValue({});
+            }
+            return result;
+        }
+        auto count = futures.size();
+        auto state = std::make_shared<State>(std::move(futures), count);
+        result.inner()->ptr()->upstream = state;
+        for (const auto& input : state->inputs) {
+            impl::future::whenSubscribe(input, result,
+                [state = state.get()](auto& target) {
+                    if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                        return;
+                    }
+                    if (state->finished.exchange(true)) {
+                        return;
+                    }
+                    if constexpr (std::is_void_v<T>) {
+                        target.supplyValue();
+                    } else {
+                        AVector<T> values;
+                        values.reserve(state->inputs.size());
+                        for (const auto& f : state->inputs) {
+                            values << *f.inner()->ptr()->value;
+                        }
+                        target.supplyValue(std::move(values));
+                    }
+                },
+                [state = state.get()](auto& target, const AException& e) {
+                    if (!state->finished.exchange(true)) {
+                        target.reportException(impl::future::causeOf(e));
+                    }
+                });
+        }
+        return result;
+    }
+
+    /**
+     * @brief Creates a future which completes when all the futures complete.
+     * @ingroup core
+     * @return AFuture<std::tuple<Ts...>> with values of the inputs.
+     * @details
+     * Heterogeneous version of when_all(AVector<AFuture<T>>).
+     */
+    template<typename... Ts>
+    AFuture<std::tuple<Ts...>> when_all(AFuture<Ts>... futures) {
+        static_assert(sizeof...(Ts) > 0, "at least one future expected");
+        static_assert((!std::is_void_v<Ts> && ...), "use when_all(AVector<AFuture<void>>) for void futures");
+        using State = impl::future::WhenState<std::tuple<AFuture<Ts>...>>;
+        AFuture<std::tuple<Ts...>> result;
+        auto state = std::make_shared<State>(std::tuple(std::move(futures)...), sizeof...(Ts));
+        result.inner()->ptr()->upstream = state;
+        auto onSuccess = [state = state.get()](auto& target) {
+            if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            if (state->finished.exchange(true)) {
+                return;
+            }
+            target.supplyValue(std::apply([](const auto&... f) {
+                return std::tuple<Ts...>(*f.inner()->ptr()->value...);
+            }, state->inputs));
+        };
+        auto onError = [state = state.get()](auto& target, const AException& e) {
+            if (!state->finished.exchange(true)) {
+                target.reportException(impl::future::causeOf(e));
+            }
+        };
+        std::apply([&](const auto&... f) {
+            (impl::future::whenSubscribe(f, result, onSuccess, onError), ...);
+        }, state->inputs);
+        return result;
+    }
+
+    /**
+     * @brief Creates a future which completes when any of the futures completes successfully.
+     * @ingroup core
+     * @param futures input futures.
+     * @return index of the first successfully completed future. Its value can be obtained without waiting.
+     * @details
+     * Completes from the thread which completed the winning input; nothing waits. Fails only if all inputs have failed
+     * (with the exception of the last one). The rest of the inputs are kept alive (and thus running) until the
+     * resulting future is destroyed.
+     */
+    template<typename T>
+    AFuture<std::size_t> when_any(AVector<AFuture<T>> futures) {
+        AUI_ASSERTX(!futures.empty(), "when_any of nothing would never complete");
+        using State = impl::future::WhenState<AVector<AFuture<T>>>;
+        AFuture<std::size_t> result;
+        auto count = futures.size();
+        auto state = std::make_shared<State>(std::move(futures), count);
+        result.inner()->ptr()->upstream = state;
+        for (std::size_t i = 0; i < state->inputs.size(); ++i) {
+            impl::future::whenSubscribe(state->inputs[i], result,
+                [state = state.get(), i](auto& target) {
+                    if (!state->finished.exchange(true)) {
+                        target.supplyValue(i);
+                    }
+                },
+                [state = state.get()](auto& target, const AException& e) {
+                    if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                        return;
+                    }
+                    if (!state->finished.exchange(true)) {
+                        target.reportException(impl::future::causeOf(e));
+                    }
+                });
+        }
+        return result;
+    }
+}
+
 #if AUI_COROUTINES
+namespace aui::impl::future {
+    /**
+     * @brief Recycling allocator for coroutine frames of AFuture-returning coroutines.
+     * @details
+     * Frames are rounded up to GRANULARITY and kept in per-thread free lists, so a steady state of coroutine calls
+     * does not touch the global allocator. Frames larger than MAX_SIZE are allocated with the global operator new.
+     * A frame may be freed on another thread than it was allocated on; it is cached by the freeing thread then.
+     */
+    struct API_AUI_CORE CoroutineFrameAllocator {
+        static constexpr std::size_t GRANULARITY = 64;
+        static constexpr std::size_t MAX_SIZE = 1024;
+        static constexpr std::size_t MAX_CACHED_FRAMES_PER_SIZE = 32;
+
+        static void* allocate(std::size_t size);
+        static void deallocate(void* frame, std::size_t size) noexcept;
+    };
+
+    /**
+     * @brief The executor a suspended coroutine should be resumed on.
+     * @details
+     * Either a thread pool, a thread processing messages (i.e. UI thread) or none (resume inline on the thread which
+     * completed the awaited operation).
+     */
+    struct API_AUI_CORE ResumeTarget {
+        AThreadPool* pool = nullptr;
+        _<AAbstractThread> thread;
+
+        /**
+         * @brief Executor of the caller.
+         * @details
+         * The thread pool if called from its worker; the current thread if it runs an event loop; inline otherwise.
+         */
+        static ResumeTarget current();
+
+        [[nodiscard]]
+        bool isCurrent() const;
+
+        void resume(std::coroutine_handle<> handle) const;
+    };
+
+    template<typename Value>
+    struct CoPromiseReturn {
+        AFuture<Value> future;
+
+        void return_value(Value v) const noexcept {
+            future.supplyValue(std::move(v));
+        }
+    };
+
+    template<>
+    struct CoPromiseReturn<void> {
+        AFuture<void> future;
+
+        void return_void() const noexcept {
+            future.supplyValue();
+        }
+    };
+
+    /**
+     * @brief Awaitable of aui::on.
+     */
+    struct SwitchToExecutor {
+        ResumeTarget target;
+
+        bool await_ready() const {
+            return target.isCurrent();
+        }
+
+        void await_suspend(std::coroutine_handle<> h) const {
+            target.resume(h);
+        }
+
+        void await_resume() const noexcept {}
+    };
+}
+
 template<typename Value>
-struct aui::impl::future::Future<Value>::CoPromiseType {
-    AFuture<Value> future;
+struct aui::impl::future::Future<Value>::CoPromiseType: aui::impl::future::CoPromiseReturn<Value> {
     auto initial_suspend() const noexcept
     {
         return std::suspend_never{};
@@ -954,18 +1415,63 @@ struct aui::impl::future::Future<Value>::CoPromiseType {
         return std::suspend_never{};
     }
     auto unhandled_exception() const noexcept {
-        future.supplyException();
+        this->future.supplyException();
     }
 
     const AFuture<Value>& get_return_object() const noexcept {
-        return future; 
+        return this->future;
+    }
+
+    static void* operator new(std::size_t size) {
+        return CoroutineFrameAllocator::allocate(size);
     }
 
-    void return_value(Value v) const noexcept {
-        future.supplyValue(std::move(v));
+    static void operator delete(void* frame, std::size_t size) noexcept {
+        CoroutineFrameAllocator::deallocate(frame, size);
     }
 };
 
+namespace aui {
+    /**
+     * @brief Awaitable that moves the coroutine to the thread pool.
+     * @ingroup core
+     * @details
+     * @code{cpp}
+     * AFuture<> MyWindow::reload() {
+     *     co_await aui::on(AThreadPool::global());
+     *     auto model = loadModel();   // runs on a worker
+     *     co_await aui::on(getThread());
+     *     mView->setModel(model);     // runs on UI thread
+     * }
+     * @endcode
+     * Does not suspend if the coroutine is already running on a worker of the pool.
+     */
+    [[nodiscard]]
+    inline impl::future::SwitchToExecutor on(AThreadPool& pool) {
+        return { { .pool = &pool, .thread = nullptr } };
+    }
+
+    /**
+     * @brief Awaitable that moves the coroutine to the thread (via its message queue).
+     * @ingroup core
+     * @details
+     * Does not suspend if the coroutine is already running on the thread.
+     * @see on(AThreadPool&)
+     */
+    [[nodiscard]]
+    inline impl::future::SwitchToExecutor on(_<AAbstractThread> thread) {
+        AUI_ASSERTX(thread != nullptr, "thread is null");
+        return { { .pool = nullptr, .thread = std::move(thread) } };
+    }
+}
+
+/**
+ * @brief Suspends the coroutine until the future is completed.
+ * @details
+ * The coroutine is resumed on the executor it was suspended on (see aui::impl::future::ResumeTarget::current): a
+ * coroutine awaiting in a thread pool worker continues in the same pool; a coroutine awaiting on UI thread continues
+ * on UI thread, regardless of which thread completed the future.
+ */
 template<typename T>
 auto operator co_await(AFuture<T> future) {
     struct Awaitable {
@@ -979,16 +1485,13 @@ auto operator co_await(AFuture<T> future) {
             return *future;
         }
 
-
-        void await_suspend(std::coroutine_handle<> h)
-        {
-            future.onSuccess([h](const int&) {
-                h.resume();
-            });
-            
-            future.onError([h](const AException&) {
-                h.resume();
-            });
+        void await_suspend(std::coroutine_handle<> h) {
+            // h may be resumed (and this awaitable destroyed) before onResult returns; keep the future on stack.
+            auto localFuture = future;
+            auto resume = [h, target = aui::impl::future::ResumeTarget::current()](const auto&...) {
+                target.resume(h);
+            };
+            localFuture.onResult(resume, resume);
         }
     };
 
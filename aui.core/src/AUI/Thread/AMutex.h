@@ -66,7 +66,8 @@ class ASpinlockMutex {
 public:
     void lock() {
         while (!try_lock()) {
-            // busy-wait
+            // busy-wait with plain loads; exchange() in try_lock would bounce the cache line between spinning cores.
+            while (mState.load(std::memory_order_relaxed) == LOCKED) {}
         }
     }
 
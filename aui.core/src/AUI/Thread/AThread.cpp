@@ -225,7 +225,7 @@ void AThread::join() {
     mThread->join();
 }
 
-void AAbstractThread::enqueue(AMessageQueue<>::Message f) {
+void AAbstractThread::enqueue(ALockFreeMessageQueue<>::Message f) {
     mMessageQueue.enqueue(std::move(f));
     if (mCurrentEventLoop) {
         std::unique_lock lock(mEventLoopLock);
@@ -281,7 +281,7 @@ void AAbstractThread::updateThreadName() noexcept {
 
 AThread::AThread(std::function<void()> functor) : mFunctor(std::move(functor)) {}
 
-bool AAbstractThread::messageQueueEmpty() noexcept { return mMessageQueue.messages().empty(); }
+bool AAbstractThread::messageQueueEmpty() noexcept { return mMessageQueue.empty(); }
 
 const _<AAbstractThread>& AThread::main() noexcept {
     static auto main = current(); // initialized by AUI_ENTRY.
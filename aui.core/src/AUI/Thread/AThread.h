@@ -16,7 +16,7 @@
 #include "AMutex.h"
 #include "AUI/Common/SharedPtrTypes.h"
 #include "AUI/Common/AString.h"
-#include "AUI/Util/AMessageQueue.h"
+#include "AUI/Util/ALockFreeMessageQueue.h"
 #include <AUI/Platform/AStacktrace.h>
 #include <functional>
 
@@ -52,10 +52,10 @@ public:
      *        itself using AEventLoop. This behaviour may be overwritten using the <code>AThread::processMessages()
      *        </code> function.
      */
-    void enqueue(AMessageQueue<>::Message f);
+    void enqueue(ALockFreeMessageQueue<>::Message f);
 
     [[nodiscard]]
-    const AMessageQueue<>& messageQueue() const {
+    const ALockFreeMessageQueue<>& messageQueue() const {
         return mMessageQueue;
     }
 
@@ -92,7 +92,7 @@ public:
      */
     template <class Callable>
     inline void operator<<(Callable fun) {
-        enqueue(fun);
+        enqueue(std::move(fun));
     }
 
     /**
@@ -102,7 +102,7 @@ public:
      */
     template <class Callable>
     inline void operator*(Callable fun) {
-        enqueue(fun);
+        enqueue(std::move(fun));
     }
 
     [[nodiscard]]
@@ -127,7 +127,7 @@ protected:
 
     AString mThreadName;
 
-    AMessageQueue<> mMessageQueue;
+    ALockFreeMessageQueue<> mMessageQueue;
 
     AAbstractThread(const id& id) noexcept;
     void updateThreadName() noexcept;
@@ -10,67 +10,197 @@
  */
 
 #include "AThreadPool.h"
+#include "ABlockingSection.h"
 #include <glm/glm.hpp>
 #include <AUI/Common/AException.h>
 #include <AUI/Logging/ALogger.h>
 #include <thread>
 #include "AUI/Platform/Entry.h"
+#include "AUI/Traits/bit.h"
 
-AThreadPool::Worker::Worker(AThreadPool& tp, size_t index)
+namespace {
+thread_local AThreadPool::Worker* gCurrentWorker = nullptr;
+
+/**
+ * @brief Increment of a counter which has a single writer; cheaper than fetch_add.
+ */
+void bump(std::atomic_uint64_t& counter, std::uint64_t value = 1) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+}
+
+AThreadPool::Worker::Worker(AThreadPool& tp, size_t index, bool temporary)
   : AThread([&, index]() {
       AThread::setName("AThreadPool #" + AString::number(index + 1));
+      gCurrentWorker = this;
 
-      std::unique_lock tpLock(mTP.mQueueLock);
+      bool retired = false;
       while (mEnabled) {
-          iteration(tpLock);
-          wait(tpLock);
+          iteration();
+          std::unique_lock tpLock(mTP.mQueueLock);
+          if (!mTemporary) {
+              wait(tpLock);
+          } else if (!waitOrRetire(tpLock)) {
+              retired = true;
+              break;
+          }
+      }
+      markStarted();
+      flushLocalQueues();
+      gCurrentWorker = nullptr;
+      if (retired) {
+          mTP.removeRetiredWorker(*this);
       }
   })
-  , mTP(tp) {}
+  , mTP(tp)
+  , mIndex(index)
+  , mTemporary(temporary) {}
 
-void AThreadPool::Worker::iteration(std::unique_lock<std::mutex>& tpLock) {
-    while (!mTP.mQueueHighest.empty() || !mTP.mQueueMedium.empty() || !mTP.mQueueLowest.empty()) {
-        if (processQueue(tpLock, mTP.mQueueHighest))
-            continue;
-        if (processQueue(tpLock, mTP.mQueueMedium))
-            continue;
-        processQueue(tpLock, mTP.mQueueLowest);
+AThreadPool::Worker* AThreadPool::Worker::currentWorker() noexcept { return gCurrentWorker; }
+
+void AThreadPool::Worker::markStarted() noexcept {
+    if (mStarting) {
+        mStarting = false;
+        mTP.mStartingWorkers -= 1;
+    }
+}
+
+void AThreadPool::Worker::iteration() {
+    while (auto func = mTP.pickTask(*this)) {
+        mBackOff = 0;
+        execute(*func);
     }
 }
 
 void AThreadPool::Worker::wait(std::unique_lock<std::mutex>& tpLock) {
-#pragma clang diagnostic push
-#pragma ide diagnostic ignored "ConstantConditionsOC"
-    if (!mEnabled)
+    assert(tpLock.owns_lock());
+    if (!mEnabled) {
         return;
-#pragma clang diagnostic pop
+    }
+    // mIdleWorkers and mPendingTasks form a handshake with AThreadPool::run: either we observe the freshly
+    // submitted task here, or the submitter observes us as idle and notifies mCV under mQueueLock.
     mTP.mIdleWorkers += 1;
-    assert(tpLock.owns_lock());
-
-    mTP.mCV.wait(tpLock);
+    markStarted();
+    if (mTP.mPendingTasks == 0) {
+        mTP.mCV.wait(tpLock);
+    } else {
+        backOff(tpLock);
+    }
     mTP.mIdleWorkers -= 1;
 }
 
-bool AThreadPool::Worker::processQueue(std::unique_lock<std::mutex>& mutex, AQueue<std::function<void()>>& queue) {
-    if (!queue.empty()) {
-        auto func = std::move(queue.front());
-        queue.pop();
-        mutex.unlock();
-        try {
-            func();
-        } catch (const AException& e) {
-            ALogger::err("uncaught exception in thread pool: " + e.getMessage());
-        } catch (const AThread::Interrupted&) {
-            // AThread::current()->resetInterruptFlag();
-        } catch (const TryLaterException&) {
-            mutex.lock();
-            mTP.mQueueTryLater.push(func);
-            return true;
-        }
-        mutex.lock();
+bool AThreadPool::Worker::waitOrRetire(std::unique_lock<std::mutex>& tpLock) {
+    assert(tpLock.owns_lock());
+    if (!mEnabled) {
         return true;
     }
-    return false;
+    bool timedOut = false;
+    mTP.mIdleWorkers += 1;
+    markStarted();
+    if (mTP.mPendingTasks == 0) {
+        timedOut = mTP.mCV.wait_for(tpLock, mTP.mElasticIdleTimeout.load()) == std::cv_status::timeout;
+    } else {
+        backOff(tpLock);
+    }
+    mTP.mIdleWorkers -= 1;
+    return !timedOut || mTP.mPendingTasks != 0;
+}
+
+void AThreadPool::Worker::backOff(std::unique_lock<std::mutex>& tpLock) {
+    static constexpr unsigned YIELDS = 4;
+    static constexpr unsigned MAX_PARK_SHIFT = 10; // ~1 ms
+    if (mBackOff < YIELDS) {
+        mBackOff += 1;
+        tpLock.unlock();
+        std::this_thread::yield();
+        tpLock.lock();
+        return;
+    }
+    auto shift = std::min(mBackOff - YIELDS, MAX_PARK_SHIFT);
+    mBackOff += 1;
+    mTP.mCV.wait_for(tpLock, std::chrono::microseconds(1u << shift));
+}
+
+void AThreadPool::Worker::execute(QueuedTask& queuedTask) {
+    auto start = std::chrono::steady_clock::now();
+    auto startNs = std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch()).count();
+    bump(mCounters.waitTime[queuedTask.priority][Telemetry::bucketOf(start - queuedTask.enqueuedAt)]);
+
+    // execute can be reentered by stackful coroutines (AFuture::wait); restore the outer task's start afterwards.
+    auto outerStartNs = mCounters.runningSinceNs.exchange(startNs, std::memory_order_relaxed);
+    try {
+        queuedTask.func();
+    } catch (const AException& e) {
+        ALogger::err("uncaught exception in thread pool: " + e.getMessage());
+    } catch (const AThread::Interrupted&) {
+        // AThread::current()->resetInterruptFlag();
+    } catch (const TryLaterException&) {
+        std::unique_lock lock(mTP.mQueueLock);
+        mTP.mQueueTryLater.push(std::move(queuedTask));
+    }
+    mCounters.runningSinceNs.store(outerStartNs, std::memory_order_relaxed);
+
+    auto duration = std::chrono::steady_clock::now() - start;
+    bump(mCounters.executionTime[queuedTask.priority][Telemetry::bucketOf(duration)]);
+    auto durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    if (durationNs > mCounters.longestExecutionNs.load(std::memory_order_relaxed)) {
+        mCounters.longestExecutionNs.store(durationNs, std::memory_order_relaxed);
+    }
+}
+
+void AThreadPool::Worker::pushLocal(QueuedTask queuedTask) {
+    auto& queue = mLocalQueues[queuedTask.priority];
+    std::unique_lock lock(queue.lock);
+    queue.tasks.push_back(std::move(queuedTask));
+    queue.size += 1;
+}
+
+AOptional<AThreadPool::QueuedTask> AThreadPool::Worker::popLocal(Priority priority) {
+    auto& queue = mLocalQueues[priority];
+    if (queue.size == 0) {
+        return std::nullopt;
+    }
+    std::unique_lock lock(queue.lock);
+    if (queue.tasks.empty()) {
+        return std::nullopt;
+    }
+    auto func = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    queue.size -= 1;
+    return func;
+}
+
+AOptional<AThreadPool::QueuedTask> AThreadPool::Worker::steal(Priority priority) {
+    auto& queue = mLocalQueues[priority];
+    if (queue.size == 0) {
+        return std::nullopt;
+    }
+    std::unique_lock lock(queue.lock, std::try_to_lock);
+    if (!lock.owns_lock() || queue.tasks.empty()) {
+        return std::nullopt;
+    }
+    auto func = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    queue.size -= 1;
+    return func;
+}
+
+void AThreadPool::Worker::flushLocalQueues() {
+    for (size_t priority = 0; priority < mLocalQueues.size(); ++priority) {
+        auto& queue = mLocalQueues[priority];
+        std::unique_lock lock(queue.lock);
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        std::unique_lock tpLock(mTP.mQueueLock);
+        auto& target = mTP.injectionQueue(static_cast<Priority>(priority));
+        for (auto& func : queue.tasks) {
+            target.push(std::move(func));
+        }
+        mTP.mInjectedTasks += queue.tasks.size();
+        queue.tasks.clear();
+        queue.size = 0;
+    }
 }
 
 AThreadPool::Worker::~Worker() {
@@ -82,28 +212,199 @@ AThreadPool::Worker::~Worker() {
 
 void AThreadPool::Worker::aboutToDelete() { mEnabled = false; }
 
-void AThreadPool::run(const std::function<void()>& fun, Priority priority) {
-    std::unique_lock lck(mQueueLock);
-
+AQueue<AThreadPool::QueuedTask>& AThreadPool::injectionQueue(Priority priority) {
     switch (priority) {
-        case PRIORITY_MEDIUM:
-            mQueueMedium.push(fun);
-            break;
         case PRIORITY_HIGHEST:
-            mQueueHighest.push(fun);
-            break;
+            return mQueueHighest;
         case PRIORITY_LOWEST:
-            mQueueLowest.push(fun);
-            break;
+            return mQueueLowest;
+        default:
+            return mQueueMedium;
+    }
+}
+
+AOptional<AThreadPool::QueuedTask> AThreadPool::popInjected(Priority priority) {
+    if (mInjectedTasks == 0) {
+        return std::nullopt;
+    }
+    std::unique_lock lck(mQueueLock);
+    auto& queue = injectionQueue(priority);
+    if (queue.empty()) {
+        return std::nullopt;
+    }
+    auto func = std::move(queue.front());
+    queue.pop();
+    mInjectedTasks -= 1;
+    return func;
+}
+
+AOptional<AThreadPool::QueuedTask> AThreadPool::pickTask(Worker& worker) {
+    if (mPendingTasks == 0) {
+        return std::nullopt;
+    }
+    for (auto priority : { PRIORITY_HIGHEST, PRIORITY_MEDIUM, PRIORITY_LOWEST }) {
+        auto func = worker.popLocal(priority);
+        if (!func) {
+            func = popInjected(priority);
+        }
+        if (!func) {
+            std::shared_lock lck(mWorkersLock);
+            for (size_t i = 1; i < mWorkers.size() && !func; ++i) {
+                auto& victim = mWorkers[(worker.mIndex + i) % mWorkers.size()];
+                if (victim.get() != &worker) {
+                    func = victim->steal(priority);
+                }
+            }
+            if (func) {
+                bump(worker.mCounters.steals);
+            }
+        }
+        if (func) {
+            mPendingTasks -= 1;
+            return func;
+        }
+    }
+    return std::nullopt;
+}
+
+void AThreadPool::run(task fun, Priority priority) {
+    QueuedTask queuedTask { std::move(fun), priority, std::chrono::steady_clock::now() };
+    if (auto worker = Worker::currentWorker(); worker && &worker->threadPool() == this && worker->mEnabled) {
+        // counted before the task can be stolen, so the thief's decrement can't make the counter wrap.
+        mPendingTasks += 1;
+        try {
+            worker->pushLocal(std::move(queuedTask));
+        } catch (...) {
+            mPendingTasks -= 1;
+            throw;
+        }
+        if (mIdleWorkers > 0) {
+            std::unique_lock lck(mQueueLock);
+            mCV.notify_one();
+        } else if (mBlockedWorkers > 0) {
+            compensateBlockedWorkers();
+        }
+        return;
+    }
+
+    {
+        std::unique_lock lck(mQueueLock);
+        injectionQueue(priority).push(std::move(queuedTask));
+        mInjectedTasks += 1;
+        mPendingTasks += 1;
+        if (mIdleWorkers > 0) {
+            mCV.notify_one();
+            return;
+        }
     }
-    if (mIdleWorkers > 0) {
-        mCV.notify_one();
+    if (mBlockedWorkers > 0) {
+        compensateBlockedWorkers();
+    }
+}
+
+void AThreadPool::onWorkerBlocked(Worker& worker) {
+    mBlockedWorkers += 1;
+    worker.markStarted();
+    if (mIdleWorkers == 0 && mPendingTasks > 0) {
+        compensateBlockedWorkers();
+    }
+}
+
+void AThreadPool::onWorkerUnblocked() noexcept {
+    mBlockedWorkers -= 1;
+}
+
+void AThreadPool::compensateBlockedWorkers() {
+    auto maxWorkers = mElasticMaxWorkers.load();
+    if (maxWorkers == 0) {
+        return;
+    }
+    AVector<_<Worker>> retiredWorkers; // joined outside the lock
+    std::unique_lock lock(mWorkersLock);
+    retiredWorkers = std::move(mRetiredWorkers);
+    // each blocked worker is compensated by at most one temporary worker. Idle and starting workers will pick the
+    // queued tasks themselves.
+    if (mWorkers.size() >= maxWorkers || mBlockedWorkers <= mTemporaryWorkers || mIdleWorkers > 0 ||
+        mStartingWorkers > 0 || mPendingTasks == 0) {
+        return;
+    }
+    try {
+        startWorker(true);
+        mTemporaryWorkers += 1;
+    } catch (const AException& e) {
+        ALogger::err("AThreadPool") << "Failed to start a temporary worker: " << e;
+    }
+}
+
+void AThreadPool::removeRetiredWorker(Worker& worker) {
+    std::unique_lock lock(mWorkersLock);
+    auto it = std::find_if(mWorkers.begin(), mWorkers.end(), [&](const _<Worker>& w) { return w.get() == &worker; });
+    if (it == mWorkers.end()) {
+        // is being removed by setWorkersCount or the destructor
+        return;
+    }
+    retire(worker);
+    mRetiredWorkers.push_back(std::move(*it));
+    mWorkers.erase(it);
+    mWorkerCount = mWorkers.size();
+    mTemporaryWorkers -= 1;
+}
+
+void AThreadPool::startWorker(bool temporary) {
+    auto worker = _new<Worker>(*this, mWorkers.size(), temporary);
+    mStartingWorkers += 1;
+    try {
+        worker->start();
+    } catch (...) {
+        mStartingWorkers -= 1;
+        throw;
+    }
+    mWorkers.push_back(std::move(worker));
+    mWorkerCount = mWorkers.size();
+}
+
+void AThreadPool::setElastic(std::size_t maxWorkers, std::chrono::milliseconds idleTimeout) {
+    mElasticIdleTimeout = idleTimeout;
+    mElasticMaxWorkers = maxWorkers;
+}
+
+ABlockingSection::ABlockingSection() {
+    auto worker = AThreadPool::Worker::currentWorker();
+    if (!worker) {
+        return;
+    }
+    mEntered = true;
+    if (worker->mBlockingDepth++ == 0) {
+        worker->mTP.onWorkerBlocked(*worker);
+    }
+}
+
+ABlockingSection::~ABlockingSection() {
+    if (!mEntered) {
+        return;
+    }
+    auto worker = AThreadPool::Worker::currentWorker();
+    AUI_ASSERT(worker != nullptr);
+    if (--worker->mBlockingDepth == 0) {
+        worker->mTP.onWorkerUnblocked();
     }
 }
 
 void AThreadPool::clear() {
+    {
+        std::shared_lock lck(mWorkersLock);
+        for (const auto& worker : mWorkers) {
+            for (auto& queue : worker->mLocalQueues) {
+                std::unique_lock queueLock(queue.lock);
+                mPendingTasks -= queue.tasks.size();
+                queue.tasks.clear();
+                queue.size = 0;
+            }
+        }
+    }
     std::unique_lock lck(mQueueLock);
 
+    mPendingTasks -= mInjectedTasks.exchange(0);
     while (!mQueueLowest.empty()) mQueueLowest.pop();
     while (!mQueueMedium.empty()) mQueueMedium.pop();
     while (!mQueueHighest.empty()) mQueueHighest.pop();
@@ -112,14 +413,19 @@ void AThreadPool::clear() {
 
 void AThreadPool::runLaterTasks() {
     std::unique_lock lck(mQueueLock);
+    auto now = std::chrono::steady_clock::now();
     while (!mQueueTryLater.empty()) {
-        mQueueLowest.emplace(std::move(mQueueTryLater.front()));
+        auto& queuedTask = mQueueLowest.emplace(std::move(mQueueTryLater.front()));
+        queuedTask.priority = PRIORITY_LOWEST;
+        queuedTask.enqueuedAt = now;
         mQueueTryLater.pop();
+        mInjectedTasks += 1;
+        mPendingTasks += 1;
     }
     mCV.notify_one();
 }
 
-void AThreadPool::enqueue(const std::function<void()>& fun, Priority priority) { global().run(fun, priority); }
+void AThreadPool::enqueue(task fun, Priority priority) { global().run(std::move(fun), priority); }
 
 AThreadPool& AThreadPool::global() {
     // deadlock fix for mingw
@@ -128,11 +434,10 @@ AThreadPool& AThreadPool::global() {
 }
 
 AThreadPool::AThreadPool(size_t size) {
+    std::unique_lock lock(mWorkersLock);
     mWorkers.reserve(size);
     for (size_t i = 0; i < size; ++i) {
-        auto worker = _new<Worker>(*this, i);
-        worker->start();
-        mWorkers.push_back(std::move(worker));
+        startWorker(false);
     }
 }
 
@@ -141,41 +446,174 @@ AThreadPool::AThreadPool()
         aui::args()
             .value("aui-threadpool-size")
             .map(&AString::toLongIntOrException)
-            .valueOr(glm::max(std::thread::hardware_concurrency() - 1, 2u))) {}
+            .valueOr(glm::max(std::thread::hardware_concurrency() - 1, 2u))) {
+    if (auto maxWorkers = aui::args().value("aui-threadpool-max-size")) {
+        setElastic(maxWorkers->toLongIntOrException());
+    }
+}
 
 AThreadPool::~AThreadPool() {
+    std::unique_lock workersLock(mWorkersLock);
     std::unique_lock lck(mQueueLock);
     auto workers = std::move(mWorkers);
+    mWorkerCount = 0;
     for (auto& f : workers) {
         f->aboutToDelete();
     }
 
     mCV.notify_all();
     lck.unlock();
+    workersLock.unlock();
 
     for (auto& f : workers) {
         f->join();
     }
+    std::unique_lock retiredLock(mWorkersLock);
+    auto retiredWorkers = std::move(mRetiredWorkers);
 }
 
 void AThreadPool::setWorkersCount(std::size_t workersCount) {
     AUI_ASSERTX(workersCount >= 2 && workersCount <= 1000, "invalid worker count");
-    std::unique_lock lck(mQueueLock);
+    std::unique_lock workersLock(mWorkersLock);
     if (mWorkers.size() >= workersCount) {
         while (mWorkers.size() > workersCount) {
-            mCV.notify_all();
-            mWorkers.last()->aboutToDelete();
-            lck.unlock();
+            auto worker = std::move(mWorkers.last());
             mWorkers.pop_back();
-            lck.lock();
+            mWorkerCount = mWorkers.size();
+            worker->aboutToDelete();
+            workersLock.unlock();
+            wakeUpAll();
+            worker->join(); // its local tasks are moved to the injection queues
+            retire(*worker);
+            if (worker->mTemporary) {
+                mTemporaryWorkers -= 1;
+            }
+            worker = nullptr;
+            workersLock.lock();
         }
     } else {
         // have to add new workers
         mWorkers.reserve(workersCount);
         while (mWorkers.size() < workersCount) {
-            mWorkers.push_back(std::make_unique<Worker>(*this, mWorkers.size()));
+            startWorker(false);
+        }
+    }
+}
+
+size_t AThreadPool::getPendingTaskCount() { return mPendingTasks; }
+
+void AThreadPool::retire(Worker& worker) {
+    auto& counters = worker.mCounters;
+    mRetiredSteals += counters.steals;
+    for (size_t priority = 0; priority <= PRIORITY_LOWEST; ++priority) {
+        for (size_t bucket = 0; bucket < Telemetry::HISTOGRAM_BUCKETS; ++bucket) {
+            mRetiredWaitTime[priority][bucket] += counters.waitTime[priority][bucket];
+            mRetiredExecutionTime[priority][bucket] += counters.executionTime[priority][bucket];
         }
     }
+    auto longest = counters.longestExecutionNs.load();
+    auto retiredLongest = mRetiredLongestExecutionNs.load();
+    while (longest > retiredLongest && !mRetiredLongestExecutionNs.compare_exchange_weak(retiredLongest, longest)) {}
 }
 
-size_t AThreadPool::getPendingTaskCount() { return mQueueHighest.size() + mQueueLowest.size() + mQueueMedium.size(); }
+AThreadPool::Telemetry AThreadPool::telemetry() {
+    Telemetry result;
+    result.timestamp = std::chrono::steady_clock::now();
+    auto nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(result.timestamp.time_since_epoch()).count();
+    result.steals = mRetiredSteals;
+    std::int64_t longestExecutionNs = mRetiredLongestExecutionNs;
+    std::int64_t longestRunningNs = 0;
+    for (size_t priority = 0; priority <= PRIORITY_LOWEST; ++priority) {
+        for (size_t bucket = 0; bucket < Telemetry::HISTOGRAM_BUCKETS; ++bucket) {
+            result.priorities[priority].waitTime[bucket] = mRetiredWaitTime[priority][bucket];
+            result.priorities[priority].executionTime[bucket] = mRetiredExecutionTime[priority][bucket];
+        }
+    }
+
+    {
+        std::shared_lock lck(mWorkersLock);
+        result.workers = mWorkers.size();
+        for (const auto& worker : mWorkers) {
+            const auto& counters = worker->mCounters;
+            result.steals += counters.steals.load(std::memory_order_relaxed);
+            longestExecutionNs = glm::max(longestExecutionNs, counters.longestExecutionNs.load(std::memory_order_relaxed));
+            if (auto runningSince = counters.runningSinceNs.load(std::memory_order_relaxed); runningSince != 0) {
+                longestRunningNs = glm::max(longestRunningNs, nowNs - runningSince);
+            }
+            for (size_t priority = 0; priority <= PRIORITY_LOWEST; ++priority) {
+                auto& target = result.priorities[priority];
+                target.queueDepth += worker->mLocalQueues[priority].size.load(std::memory_order_relaxed);
+                for (size_t bucket = 0; bucket < Telemetry::HISTOGRAM_BUCKETS; ++bucket) {
+                    target.waitTime[bucket] += counters.waitTime[priority][bucket].load(std::memory_order_relaxed);
+                    target.executionTime[bucket] +=
+                        counters.executionTime[priority][bucket].load(std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+    {
+        std::unique_lock lck(mQueueLock);
+        for (size_t priority = 0; priority <= PRIORITY_LOWEST; ++priority) {
+            result.priorities[priority].queueDepth += injectionQueue(static_cast<Priority>(priority)).size();
+        }
+    }
+    result.idleWorkers = mIdleWorkers;
+    result.longestExecution = std::chrono::nanoseconds(longestExecutionNs);
+    result.longestRunning = std::chrono::nanoseconds(longestRunningNs);
+    return result;
+}
+
+std::uint64_t AThreadPool::Telemetry::PerPriority::executed() const noexcept {
+    std::uint64_t result = 0;
+    for (auto count : executionTime) {
+        result += count;
+    }
+    return result;
+}
+
+std::uint64_t AThreadPool::Telemetry::executed() const noexcept {
+    std::uint64_t result = 0;
+    for (const auto& priority : priorities) {
+        result += priority.executed();
+    }
+    return result;
+}
+
+double AThreadPool::Telemetry::tasksPerSecond(const Telemetry& previous) const noexcept {
+    auto seconds = std::chrono::duration<double>(timestamp - previous.timestamp).count();
+    if (seconds <= 0) {
+        return 0;
+    }
+    return double(executed() - previous.executed()) / seconds;
+}
+
+size_t AThreadPool::Telemetry::bucketOf(std::chrono::nanoseconds duration) noexcept {
+    auto us = static_cast<std::uint64_t>(glm::max(std::chrono::duration_cast<std::chrono::microseconds>(duration).count(), std::int64_t(0)));
+    return glm::min(size_t(aui::bit_width(us)), HISTOGRAM_BUCKETS - 1);
+}
+
+std::chrono::nanoseconds AThreadPool::Telemetry::bucketUpperBound(size_t bucket) noexcept {
+    if (bucket + 1 >= HISTOGRAM_BUCKETS) {
+        return std::chrono::nanoseconds::max();
+    }
+    return std::chrono::microseconds(std::uint64_t(1) << bucket);
+}
+
+std::chrono::nanoseconds AThreadPool::Telemetry::percentile(const Histogram& histogram, double p) noexcept {
+    std::uint64_t total = 0;
+    for (auto count : histogram) {
+        total += count;
+    }
+    if (total == 0) {
+        return std::chrono::nanoseconds(0);
+    }
+    auto threshold = static_cast<std::uint64_t>(glm::ceil(glm::clamp(p, 0.0, 1.0) * double(total)));
+    std::uint64_t accumulated = 0;
+    for (size_t bucket = 0; bucket < HISTOGRAM_BUCKETS; ++bucket) {
+        accumulated += histogram[bucket];
+        if (accumulated >= glm::max(threshold, std::uint64_t(1))) {
+            return bucketUpperBound(bucket);
+        }
+    }
+    return bucketUpperBound(HISTOGRAM_BUCKETS - 1);
+}
@@ -1,4 +1,4 @@
-/*
+﻿/*
  * AUI Framework - Declarative UI toolkit for modern C++20
  * Copyright (C) 2020-2025 Alex2772 and Contributors
  *
@@ -14,9 +14,15 @@
 #include <AUI/Core.h>
 #include <cassert>
 #include <atomic>
+#include <array>
+#include <chrono>
+#include <shared_mutex>
 
 #include <AUI/Common/AVector.h>
 #include <AUI/Common/AQueue.h>
+#include <AUI/Common/ADeque.h>
+#include <AUI/Common/AOptional.h>
+#include <AUI/Common/AMoveOnlyFunction.h>
 #include <AUI/Common/AException.h>
 #include <AUI/Thread/AThread.h>
 #include <glm/glm.hpp>
@@ -32,25 +38,210 @@ class AFuture;
  */
 class API_AUI_CORE AThreadPool {
 public:
+    enum Priority {
+        PRIORITY_HIGHEST,
+        PRIORITY_MEDIUM,
+        PRIORITY_LOWEST,
+    };
+
+    /**
+     * @brief Move-only task type. Captures up to 48 bytes are stored without dynamic allocation.
+     */
+    typedef AMoveOnlyFunction<void()> task;
+
+    /**
+     * @brief Task with metadata for telemetry.
+     */
+    struct QueuedTask {
+        task func;
+        Priority priority;
+        std::chrono::steady_clock::time_point enqueuedAt;
+    };
+
+    /**
+     * @brief Snapshot of thread pool statistics.
+     * @details
+     * Obtained by AThreadPool::telemetry(). Counters are cumulative since the pool creation; compare two snapshots to
+     * get rates (see tasksPerSecond()).
+     *
+     * Histograms are logarithmic: bucket 0 counts durations below 1us, bucket i counts durations in
+     * [2^(i-1), 2^i) us, the last bucket counts everything longer.
+     */
+    struct Telemetry {
+        static constexpr size_t HISTOGRAM_BUCKETS = 24;
+        using Histogram = std::array<std::uint64_t, HISTOGRAM_BUCKETS>;
+
+        struct PerPriority {
+            /**
+             * @brief Tasks waiting for execution at the moment of the snapshot.
+             */
+            size_t queueDepth = 0;
+
+            /**
+             * @brief Time between AThreadPool::run and the start of execution.
+             */
+            Histogram waitTime{};
+
+            /**
+             * @brief Execution time of tasks.
+             */
+            Histogram executionTime{};
+
+            /**
+             * @return count of executed tasks.
+             */
+            [[nodiscard]]
+            std::uint64_t executed() const noexcept;
+        };
+
+        std::chrono::steady_clock::time_point timestamp;
+        std::array<PerPriority, 3> priorities;
+        size_t workers = 0;
+        size_t idleWorkers = 0;
+
+        /**
+         * @brief Count of tasks taken by a worker from another worker's queue.
+         */
+        std::uint64_t steals = 0;
+
+        /**
+         * @brief The longest execution of a single task.
+         */
+        std::chrono::nanoseconds longestExecution{0};
+
+        /**
+         * @brief For how long the longest of currently running tasks is running.
+         */
+        std::chrono::nanoseconds longestRunning{0};
+
+        /**
+         * @return count of executed tasks of all priorities.
+         */
+        [[nodiscard]]
+        std::uint64_t executed() const noexcept;
+
+        /**
+         * @return executed tasks per second between the previous snapshot and this one.
+         */
+        [[nodiscard]]
+        double tasksPerSecond(const Telemetry& previous) const noexcept;
+
+        /**
+         * @return upper bound of the histogram's bucket containing the given percentile ([0;1]) of samples.
+         */
+        [[nodiscard]]
+        static std::chrono::nanoseconds percentile(const Histogram& histogram, double p) noexcept;
+
+        /**
+         * @return exclusive upper bound of the bucket, or nanoseconds::max() for the last one.
+         */
+        [[nodiscard]]
+        static std::chrono::nanoseconds bucketUpperBound(size_t bucket) noexcept;
+
+        [[nodiscard]]
+        static size_t bucketOf(std::chrono::nanoseconds duration) noexcept;
+    };
+
+    /**
+     * @brief Thread pool worker.
+     * @details
+     * Each worker owns a deque per priority. Tasks that are submitted to the pool from the worker's thread are pushed
+     * to the back of its own deque and popped from the back (LIFO, cache friendly). Idle workers steal tasks from the
+     * front of other workers' deques. Tasks that are submitted from foreign threads go to the shared injection queue.
+     */
     class API_AUI_CORE Worker : public AThread {
     private:
-        bool mEnabled = true;
-        bool processQueue(std::unique_lock<std::mutex>& mutex, AQueue<std::function<void()>>& queue);
-        AThreadPool& mTP;
+        struct LocalQueue {
+            std::mutex lock;
+            ADeque<QueuedTask> tasks;
+            std::atomic_size_t size = 0;
+        };
 
-        void iteration(std::unique_lock<std::mutex>& tpLock);
+        /**
+         * @brief Telemetry counters. Written by the worker's thread only (hence no read-modify-write atomics), read
+         * by AThreadPool::telemetry().
+         */
+        struct Counters {
+            using Histogram = std::array<std::atomic_uint64_t, Telemetry::HISTOGRAM_BUCKETS>;
+            std::array<Histogram, PRIORITY_LOWEST + 1> waitTime{};
+            std::array<Histogram, PRIORITY_LOWEST + 1> executionTime{};
+            std::atomic_uint64_t steals = 0;
+            std::atomic_int64_t longestExecutionNs = 0;
+
+            /**
+             * @brief steady_clock time of the current task start in ns, or 0 if the worker is idle.
+             */
+            std::atomic_int64_t runningSinceNs = 0;
+        };
+
+        std::atomic_bool mEnabled = true;
+        AThreadPool& mTP;
+        size_t mIndex;
+        std::array<LocalQueue, PRIORITY_LOWEST + 1> mLocalQueues;
+        Counters mCounters;
+
+        /**
+         * @brief The worker was started by elastic mode to compensate a blocked worker; retires when idle.
+         */
+        bool mTemporary = false;
+
+        /**
+         * @brief Nesting depth of ABlockingSection. Accessed by the worker's thread only.
+         */
+        size_t mBlockingDepth = 0;
+
+        /**
+         * @brief The worker is accounted in AThreadPool::mStartingWorkers. Accessed by the worker's thread only.
+         */
+        bool mStarting = true;
+
+        /**
+         * @brief Count of consecutive waits with tasks pending but none picked. Accessed by the worker's thread only.
+         */
+        unsigned mBackOff = 0;
+
+        /**
+         * @brief Removes the worker from AThreadPool::mStartingWorkers once it is accounted as idle or blocked.
+         */
+        void markStarted() noexcept;
+
+        void iteration();
         void wait(std::unique_lock<std::mutex>& tpLock);
 
+        /**
+         * @brief Same as wait, but gives up after the elastic idle timeout.
+         * @return false if the temporary worker should retire.
+         */
+        bool waitOrRetire(std::unique_lock<std::mutex>& tpLock);
+
+        /**
+         * @brief Waits while tasks are pending but none could be picked, as their queues were locked by the owners or
+         * other thieves.
+         * @details
+         * Yields first, then parks for growing intervals, so the worker does not spin on the locks. Submitted tasks
+         * wake the worker as usual.
+         */
+        void backOff(std::unique_lock<std::mutex>& tpLock);
+        void execute(QueuedTask& queuedTask);
+
+        void pushLocal(QueuedTask queuedTask);
+        AOptional<QueuedTask> popLocal(Priority priority);
+        AOptional<QueuedTask> steal(Priority priority);
+        void flushLocalQueues();
+
+        friend class AThreadPool;
+        friend class ABlockingSection;
+
     public:
-        Worker(AThreadPool& tp, size_t index);
+        Worker(AThreadPool& tp, size_t index, bool temporary = false);
         ~Worker();
         void aboutToDelete();
 
         template <aui::predicate ShouldContinue>
         void loop(ShouldContinue&& shouldContinue) {
-            std::unique_lock lock(mTP.mQueueLock);
             while (shouldContinue()) {
-                iteration(lock);
+                iteration();
+                std::unique_lock lock(mTP.mQueueLock);
                 if (!shouldContinue()) {
                     return;
                 }
@@ -59,24 +250,96 @@ public:
         }
 
         AThreadPool& threadPool() noexcept { return mTP; }
-    };
 
-    enum Priority {
-        PRIORITY_HIGHEST,
-        PRIORITY_MEDIUM,
-        PRIORITY_LOWEST,
+        /**
+         * @return worker of the caller thread, or nullptr if the caller thread is not a thread pool worker.
+         */
+        static Worker* currentWorker() noexcept;
     };
 
 protected:
-    typedef std::function<void()> task;
+    friend class ABlockingSection;
+
     AVector<_<Worker>> mWorkers;
-    AQueue<task> mQueueHighest;
-    AQueue<task> mQueueMedium;
-    AQueue<task> mQueueLowest;
-    AQueue<task> mQueueTryLater;
+
+    /**
+     * @brief Guards mWorkers and mRetiredWorkers. Temporary workers of elastic mode modify mWorkers from their threads.
+     */
+    mutable std::shared_mutex mWorkersLock;
+
+    /**
+     * @brief mWorkers.size(), readable without mWorkersLock.
+     */
+    std::atomic_size_t mWorkerCount = 0;
+
+    /**
+     * @brief Workers which have been started but have not become idle or blocked yet.
+     * @details
+     * Such workers are about to pick queued tasks, so elastic mode does not compensate blocked workers with temporary
+     * ones while there are any.
+     */
+    std::atomic_size_t mStartingWorkers = 0;
+
+    /**
+     * @brief Injection queues for tasks submitted from threads that are not workers of this pool.
+     */
+    AQueue<QueuedTask> mQueueHighest;
+    AQueue<QueuedTask> mQueueMedium;
+    AQueue<QueuedTask> mQueueLowest;
+    AQueue<QueuedTask> mQueueTryLater;
     std::mutex mQueueLock;
     std::condition_variable mCV;
-    size_t mIdleWorkers = 0;
+    std::atomic_size_t mIdleWorkers = 0;
+    std::atomic_size_t mPendingTasks = 0;
+    std::atomic_size_t mInjectedTasks = 0;
+
+    /**
+     * @brief Counters of the workers removed by setWorkersCount, so they do not disappear from telemetry.
+     */
+    std::atomic_uint64_t mRetiredSteals = 0;
+    std::array<std::array<std::atomic_uint64_t, Telemetry::HISTOGRAM_BUCKETS>, PRIORITY_LOWEST + 1> mRetiredWaitTime{};
+    std::array<std::array<std::atomic_uint64_t, Telemetry::HISTOGRAM_BUCKETS>, PRIORITY_LOWEST + 1> mRetiredExecutionTime{};
+    std::atomic_int64_t mRetiredLongestExecutionNs = 0;
+
+    /**
+     * @brief Elastic mode: max total count of workers; 0 if elastic mode is disabled.
+     */
+    std::atomic_size_t mElasticMaxWorkers = 0;
+    std::atomic<std::chrono::milliseconds> mElasticIdleTimeout { std::chrono::seconds(10) };
+
+    /**
+     * @brief Workers inside ABlockingSection.
+     */
+    std::atomic_size_t mBlockedWorkers = 0;
+
+    /**
+     * @brief Alive temporary workers (see Worker::mTemporary).
+     */
+    std::atomic_size_t mTemporaryWorkers = 0;
+
+    /**
+     * @brief Temporary workers which have retired, to be joined. Guarded by mWorkersLock.
+     */
+    AVector<_<Worker>> mRetiredWorkers;
+
+    AQueue<QueuedTask>& injectionQueue(Priority priority);
+    AOptional<QueuedTask> popInjected(Priority priority);
+    AOptional<QueuedTask> pickTask(Worker& worker);
+    void retire(Worker& worker);
+
+    /**
+     * @brief Creates and starts a worker. mWorkersLock is expected to be locked exclusively.
+     */
+    void startWorker(bool temporary);
+
+    void onWorkerBlocked(Worker& worker);
+    void onWorkerUnblocked() noexcept;
+
+    /**
+     * @brief Starts a temporary worker if blocked workers leave queued tasks without a runnable worker.
+     */
+    void compensateBlockedWorkers();
+    void removeRetiredWorker(Worker& worker);
 
 public:
     /**
@@ -95,13 +358,36 @@ public:
     size_t getTotalTaskCount() {
         return getPendingTaskCount() + getTotalWorkerCount() - getIdleWorkerCount();
     }
-    void run(const std::function<void()>& fun, Priority priority = PRIORITY_MEDIUM);
+    void run(task fun, Priority priority = PRIORITY_MEDIUM);
     void clear();
     void runLaterTasks();
-    static void enqueue(const std::function<void()>& fun, Priority priority = PRIORITY_MEDIUM);
+    static void enqueue(task fun, Priority priority = PRIORITY_MEDIUM);
 
     void setWorkersCount(std::size_t workersCount);
 
+    /**
+     * @brief Enables or disables elastic mode.
+     * @param maxWorkers max total count of workers, including temporary ones. 0 disables elastic mode.
+     * @param idleTimeout temporary worker retires after being idle for this long.
+     * @details
+     * By default, the count of workers is fixed. Tasks that block (waiting for AFuture with AFutureWait::JUST_WAIT,
+     * AThread::sleep, socket reads, ACurl::Builder::runBlocking, etc...) occupy the worker, and if all workers are
+     * blocked, the rest of the queue stalls or even deadlocks.
+     *
+     * In elastic mode, a worker entering ABlockingSection lets the pool start a temporary worker, as long as there are
+     * queued tasks, no idle workers and the total count of workers is below maxWorkers. Temporary workers retire after
+     * idleTimeout of idling.
+     *
+     * Elastic mode of AThreadPool::global() can be enabled with --aui-threadpool-max-size=MAX passed to your
+     * application.
+     */
+    void setElastic(std::size_t maxWorkers, std::chrono::milliseconds idleTimeout = std::chrono::seconds(10));
+
+    [[nodiscard]]
+    bool isElastic() const noexcept {
+        return mElasticMaxWorkers != 0;
+    }
+
     void wakeUpAll() {
         std::unique_lock lck(mQueueLock);
         mCV.notify_all();
@@ -112,14 +398,27 @@ public:
      */
     static AThreadPool& global();
 
+    /**
+     * @return snapshot of the workers. In elastic mode, temporary workers are added and removed concurrently.
+     */
     [[nodiscard]]
-    const AVector<_<Worker>>& workers() const {
+    AVector<_<Worker>> workers() const {
+        std::shared_lock lock(mWorkersLock);
         return mWorkers;
     }
 
-    size_t getTotalWorkerCount() const { return mWorkers.size(); }
+    size_t getTotalWorkerCount() const { return mWorkerCount; }
     size_t getIdleWorkerCount() const { return mIdleWorkers; }
 
+    /**
+     * @brief Collects statistics of the pool.
+     * @details
+     * Workers maintain their own counters without synchronization with each other; telemetry() sums them up. The
+     * snapshot is not atomic as a whole: tasks completing during the call may or may not be accounted.
+     */
+    [[nodiscard]]
+    Telemetry telemetry();
+
     /**
      * Parallels work of some range, grouping tasks per thread (i.e. for 8 items on a 4-core processor each core will
      * process 2 items)
@@ -131,6 +430,8 @@ public:
      *
      * @return future set per thread (i.e. for 8 items on a 4-core processor there will be 4 futures)
      *
+     * @see aui::parallel_for for dynamic load balancing.
+     *
      * <dl>
      *   <dt><b>Performance note</b></dt>
      *   <dd>
@@ -262,7 +563,7 @@ auto AThreadPool::parallel(Iterator begin, Iterator end, Functor&& functor) {
     AFutureSet<ResultType> futureSet;
 
     size_t itemCount = end - begin;
-    size_t affinity = (glm::min) (AThreadPool::global().getTotalWorkerCount(), itemCount);
+    size_t affinity = (glm::min) (getTotalWorkerCount(), itemCount);
     if (affinity == 0)
         return futureSet;
     size_t itemsPerThread = itemCount / affinity;
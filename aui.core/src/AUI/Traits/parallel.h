@@ -14,6 +14,17 @@
 
 #include <AUI/Thread/AThreadPool.h>
 #include <AUI/Traits/iterators.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <vector>
 
 namespace aui {
     /**
@@ -47,6 +58,115 @@ namespace aui {
     }
 
     namespace impl::parallel {
+        /**
+         * @brief Shared state of a parallel_for invocation.
+         * @details
+         * Kept alive by the helper tasks, so a helper that was picked up by a worker after the invocation has already
+         * returned finds no work and exits.
+         */
+        struct ChunkState {
+            std::size_t count;
+            std::size_t grainSize;
+            std::size_t participants;
+            void* body;
+            void (*invoke)(void* body, std::size_t begin, std::size_t end);
+
+            std::atomic_size_t next = 0;
+            std::atomic_size_t done = 0;
+            std::atomic_bool failed = false;
+            std::exception_ptr exception;
+            std::mutex sync;
+            std::condition_variable cv;
+
+            /**
+             * @brief Claims chunks and executes them until the range is exhausted.
+             * @details
+             * Chunk size is proportional to the remaining range (guided scheduling): first chunks are large to reduce
+             * synchronization, last chunks are small (but not smaller than grainSize) to balance skewed workloads.
+             */
+            void claimAndRun() noexcept {
+                for (;;) {
+                    auto begin = next.load(std::memory_order_relaxed);
+                    std::size_t end;
+                    do {
+                        if (begin >= count) {
+                            return;
+                        }
+                        auto remaining = count - begin;
+                        auto chunk = (std::max)(grainSize, remaining / (2 * participants));
+                        end = begin + (std::min)(chunk, remaining);
+                    } while (!next.compare_exchange_weak(begin, end, std::memory_order_relaxed));
+
+                    if (!failed.load(std::memory_order_relaxed)) {
+                        try {
+                            invoke(body, begin, end);
+                        } catch (...) {
+                            std::unique_lock lock(sync);
+                            if (!exception) {
+                                exception = std::current_exception();
+                            }
+                            failed = true;
+                        }
+                    }
+
+                    if (done.fetch_add(end - begin, std::memory_order_acq_rel) + (end - begin) == count) {
+                        std::unique_lock lock(sync);
+                        cv.notify_all();
+                    }
+                }
+            }
+
+            void waitForAll() {
+                if (done.load(std::memory_order_acquire) == count) {
+                    return;
+                }
+                std::unique_lock lock(sync);
+                cv.wait(lock, [&] { return done.load(std::memory_order_acquire) == count; });
+            }
+        };
+
+        /**
+         * @brief Splits [0;count) into chunks and executes body(chunkBegin, chunkEnd) on the thread pool's workers and
+         * the calling thread.
+         */
+        template<typename Body>
+        void forChunks(AThreadPool& pool, std::size_t count, std::size_t grainSize, Body&& body) {
+            if (count == 0) {
+                return;
+            }
+            const auto participants = pool.getTotalWorkerCount() + 1;
+            if (grainSize == 0) {
+                grainSize = (std::max)(count / (participants * 16), std::size_t(1));
+            }
+            const auto maxChunks = (count + grainSize - 1) / grainSize;
+            const auto helpers = (std::min)(participants - 1, maxChunks - 1);
+            if (helpers == 0) {
+                body(std::size_t(0), count);
+                return;
+            }
+
+            auto state = _new<ChunkState>();
+            state->count = count;
+            state->grainSize = grainSize;
+            state->participants = helpers + 1;
+            state->body = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+            state->invoke = [](void* body, std::size_t begin, std::size_t end) {
+                (*static_cast<std::remove_reference_t<Body>*>(body))(begin, end);
+            };
+
+            for (std::size_t i = 0; i < helpers; ++i) {
+                pool.run([state] { state->claimAndRun(); }, AThreadPool::PRIORITY_HIGHEST);
+            }
+
+            // the calling thread joins in the work instead of blocking.
+            state->claimAndRun();
+            state->waitForAll();
+
+            if (state->exception) {
+                std::rethrow_exception(state->exception);
+            }
+        }
+
         template<typename Container>
         struct LambdaCapturer {
             using iterator = decltype(std::declval<Container>().begin());
@@ -66,6 +186,200 @@ namespace aui {
     }
 }
 
+namespace aui {
+    /**
+     * @brief Executes body over a random access range with dynamic load balancing.
+     * @tparam Iterator random access iterator or integral type
+     * @param begin range begin
+     * @param end range end
+     * @param body callback. <code>void(Iterator chunkBegin, Iterator chunkEnd);</code>
+     * @param grainSize minimal count of elements per chunk. 0 picks the value automatically.
+     * @param pool thread pool to execute on.
+     * @details
+     * Unlike aui::parallel, the range is not split evenly by worker count. Participating threads claim chunks from a
+     * shared counter as they finish previous ones, so skewed workloads do not leave cores idle. The calling thread
+     * participates in the work and returns when the whole range is processed. If body throws, the remaining chunks are
+     * skipped and the first exception is rethrown on the calling thread.
+     *
+     * @code{cpp}
+     * AVector<int> container = { ... };
+     * aui::parallel_for(container.begin(), container.end(), [](auto begin, auto end) {
+     *     for (auto it = begin; it != end; ++it) {
+     *         // *it
+     *     }
+     * });
+     * @endcode
+     */
+    template<typename Iterator, typename Body>
+    void parallel_for(Iterator begin, Iterator end, Body&& body, std::size_t grainSize = 0,
+                      AThreadPool& pool = AThreadPool::global()) {
+        impl::parallel::forChunks(pool, std::size_t(end - begin), grainSize,
+                                  [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+            body(begin + chunkBegin, begin + chunkEnd);
+        });
+    }
+
+    /**
+     * @brief Reduces the range with an associative and commutative operation in parallel.
+     * @param begin range begin
+     * @param end range end
+     * @param init initial value
+     * @param op reduce operation. <code>T(T, T)</code>; elements must be convertible to T.
+     * @param grainSize minimal count of elements per chunk. 0 picks the value automatically.
+     * @param pool thread pool to execute on.
+     * @return reduced value
+     * @details
+     * Parallel counterpart of std::reduce. Each chunk is reduced locally starting from its first element; partial
+     * results are combined with the same op, so a heterogeneous <code>T(T, Element)</code> operation is not supported.
+     * Transform the elements with parallel_transform first or accumulate chunks in aui::parallel_for instead.
+     */
+    template<typename Iterator, typename T, typename BinaryOp = std::plus<>>
+    T parallel_reduce(Iterator begin, Iterator end, T init, BinaryOp op = {}, std::size_t grainSize = 0,
+                      AThreadPool& pool = AThreadPool::global()) {
+        static_assert(std::is_invocable_r_v<T, BinaryOp&, T, T>, "op is expected to be T(T, T)");
+        std::mutex sync;
+        impl::parallel::forChunks(pool, std::size_t(end - begin), grainSize,
+                                  [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+            auto it = begin + chunkBegin;
+            T local = *it;
+            for (++it; it != begin + chunkEnd; ++it) {
+                local = op(std::move(local), *it);
+            }
+            std::unique_lock lock(sync);
+            init = op(std::move(init), std::move(local));
+        });
+        return init;
+    }
+
+    /**
+     * @brief Applies op to each element of the range and stores the result to the output range in parallel.
+     * @param begin input range begin
+     * @param end input range end
+     * @param output output range begin. Must be random access and have at least end - begin elements.
+     * @param op transform operation. <code>Output(Element)</code>
+     * @param grainSize minimal count of elements per chunk. 0 picks the value automatically.
+     * @param pool thread pool to execute on.
+     * @return iterator past the last written element.
+     */
+    template<typename Iterator, typename OutputIterator, typename UnaryOp>
+    OutputIterator parallel_transform(Iterator begin, Iterator end, OutputIterator output, UnaryOp&& op,
+                                      std::size_t grainSize = 0, AThreadPool& pool = AThreadPool::global()) {
+        impl::parallel::forChunks(pool, std::size_t(end - begin), grainSize,
+                                  [&](std::size_t chunkBegin, std::size_t chunkEnd) {
+            std::transform(begin + chunkBegin, begin + chunkEnd, output + chunkBegin, op);
+        });
+        return output + (end - begin);
+    }
+
+    /**
+     * @brief Sorts the range in parallel.
+     * @param begin range begin
+     * @param end range end
+     * @param comp comparator
+     * @param pool thread pool to execute on.
+     * @details
+     * The range is split into blocks which are sorted in parallel, then the sorted blocks are merged pairwise in
+     * parallel rounds. Not stable.
+     */
+    template<typename Iterator, typename Compare = std::less<>>
+    void parallel_sort(Iterator begin, Iterator end, Compare comp = {}, AThreadPool& pool = AThreadPool::global()) {
+        static constexpr std::size_t MIN_BLOCK_SIZE = 2048;
+        const auto count = std::size_t(end - begin);
+        const auto blockCount = (std::min)(pool.getTotalWorkerCount() + 1, count / MIN_BLOCK_SIZE);
+        if (blockCount <= 1) {
+            std::sort(begin, end, comp);
+            return;
+        }
+        auto blockBegin = [&](std::size_t block) { return begin + count * block / blockCount; };
+
+        impl::parallel::forChunks(pool, blockCount, 1, [&](std::size_t first, std::size_t last) {
+            for (auto block = first; block != last; ++block) {
+                std::sort(blockBegin(block), blockBegin(block + 1), comp);
+            }
+        });
+
+        for (std::size_t width = 1; width < blockCount; width *= 2) {
+            const auto merges = (blockCount + 2 * width - 1) / (2 * width);
+            impl::parallel::forChunks(pool, merges, 1, [&](std::size_t first, std::size_t last) {
+                for (auto merge = first; merge != last; ++merge) {
+                    auto left = merge * 2 * width;
+                    auto middle = (std::min)(left + width, blockCount);
+                    auto right = (std::min)(left + 2 * width, blockCount);
+                    if (middle != right) {
+                        std::inplace_merge(blockBegin(left), blockBegin(middle), blockBegin(right), comp);
+                    }
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Computes inclusive prefix "sums" of the range in parallel.
+     * @param begin input range begin
+     * @param end input range end
+     * @param output output range begin. Must be random access and have at least end - begin elements. Can be equal
+     *        to begin.
+     * @param op associative operation.
+     * @param grainSize minimal count of elements per block. 0 picks the value automatically.
+     * @param pool thread pool to execute on.
+     * @return iterator past the last written element.
+     * @details
+     * Parallel counterpart of std::inclusive_scan. Blocks are reduced in parallel, block offsets are computed
+     * sequentially, then each block is scanned with its offset in parallel.
+     */
+    template<typename Iterator, typename OutputIterator, typename BinaryOp = std::plus<>>
+    OutputIterator parallel_inclusive_scan(Iterator begin, Iterator end, OutputIterator output, BinaryOp op = {},
+                                           std::size_t grainSize = 0, AThreadPool& pool = AThreadPool::global()) {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        const auto count = std::size_t(end - begin);
+        if (count == 0) {
+            return output;
+        }
+        const auto participants = pool.getTotalWorkerCount() + 1;
+        if (grainSize == 0) {
+            grainSize = (std::max)(count / (participants * 4), std::size_t(1024));
+        }
+        const auto blockCount = (count + grainSize - 1) / grainSize;
+        if (blockCount <= 1) {
+            return std::inclusive_scan(begin, end, output, op);
+        }
+        auto blockBegin = [&](std::size_t block) { return (std::min)(block * grainSize, count); };
+
+        // 1. reduce each block
+        std::vector<std::optional<T>> offsets(blockCount);
+        impl::parallel::forChunks(pool, blockCount - 1, 1, [&](std::size_t first, std::size_t last) {
+            for (auto block = first; block != last; ++block) {
+                auto it = begin + blockBegin(block);
+                T sum = *it;
+                for (++it; it != begin + blockBegin(block + 1); ++it) {
+                    sum = op(std::move(sum), *it);
+                }
+                offsets[block + 1] = std::move(sum);
+            }
+        });
+
+        // 2. exclusive scan of block sums
+        for (std::size_t block = 2; block < blockCount; ++block) {
+            offsets[block] = op(*offsets[block - 1], std::move(*offsets[block]));
+        }
+
+        // 3. scan each block with its offset
+        impl::parallel::forChunks(pool, blockCount, 1, [&](std::size_t first, std::size_t last) {
+            for (auto block = first; block != last; ++block) {
+                auto from = begin + blockBegin(block);
+                auto to = begin + blockBegin(block + 1);
+                auto out = output + blockBegin(block);
+                if (offsets[block]) {
+                    std::inclusive_scan(from, to, out, op, *offsets[block]);
+                } else {
+                    std::inclusive_scan(from, to, out, op);
+                }
+            }
+        });
+        return output + count;
+    }
+}
+
 /**
  * @brief Shortcut to aui::parallel.
  * @details
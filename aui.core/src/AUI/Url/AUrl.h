@@ -64,6 +64,10 @@ public:
         return full() < u.full();
     }
 
+    bool operator==(const AUrl& u) const noexcept {
+        return mSchema == u.mSchema && mPath == u.mPath;
+    }
+
     static void registerResolver(const AString& protocol, Resolver resolver);
 
 private:
@@ -74,6 +78,14 @@ private:
 };
 
 
+template<>
+struct std::hash<AUrl> {
+    std::size_t operator()(const AUrl& url) const noexcept {
+        std::hash<AString> hash;
+        return hash(url.schema()) * 31 + hash(url.path());
+    }
+};
+
 inline AUrl operator""_url(const char* input, size_t s) {
     return AUrl(std::string{input, input + s});
 }
\ No newline at end of file
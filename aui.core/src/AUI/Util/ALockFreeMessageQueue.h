@@ -0,0 +1,122 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <AUI/Common/AMoveOnlyFunction.h>
+
+/**
+ * @brief Lock-free multi-producer/single-consumer message (callback) queue.
+ * @ingroup core
+ * @details
+ * Similar to AMessageQueue, but enqueue() never blocks: producers append a node to an intrusive linked
+ * list with a single atomic exchange, so many threads posting to the same thread do not serialize on a mutex.
+ *
+ * Only one thread (the owner of the queue) is allowed to call processMessages() and pop(). enqueue(), empty() and
+ * size() can be called from any thread.
+ *
+ * The implementation is based on Dmitry Vyukov's non-intrusive MPSC node-based queue. Messages are processed in FIFO
+ * order per producer. The implementation supports enqueueing new messages inside the callbacks.
+ */
+template<typename... Args>
+class ALockFreeMessageQueue {
+public:
+    using Message = AMoveOnlyFunction<void(Args...)>;
+
+    ALockFreeMessageQueue(): mHead(new Node), mTail(mHead.load(std::memory_order_relaxed)) {}
+    ALockFreeMessageQueue(const ALockFreeMessageQueue&) = delete;
+    ALockFreeMessageQueue& operator=(const ALockFreeMessageQueue&) = delete;
+
+    ~ALockFreeMessageQueue() {
+        while (mTail) {
+            delete std::exchange(mTail, mTail->next.load(std::memory_order_relaxed));
+        }
+    }
+
+    /**
+     * @brief Add message to the queue to process in processMessages().
+     */
+    void enqueue(Message message) {
+        auto node = new Node{ {}, std::move(message) };
+
+        // increase size before publishing the node so empty() never reports false negatives.
+        mSize.fetch_add(1, std::memory_order_release);
+        auto prev = mHead.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pops the oldest message.
+     * @return the message or empty message if the queue is empty.
+     * @details
+     * Should be called from the consumer thread only.
+     */
+    Message pop() noexcept {
+        auto tail = mTail;
+        auto next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return nullptr;
+        }
+        auto message = std::move(next->message);
+        mTail = next; // next becomes the stub node
+        delete tail;
+        mSize.fetch_sub(1, std::memory_order_relaxed);
+        return message;
+    }
+
+    /**
+     * @brief Process messages submitted by enqueue method.
+     * @details
+     * Should be called from the consumer thread only.
+     */
+    void processMessages(Args... args) {
+        // cheap lookahead that does not require any synchronization.
+        if (empty()) {
+            return;
+        }
+        while (auto message = pop()) {
+            message(args...);
+        }
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+        return mSize.load(std::memory_order_acquire) == 0;
+    }
+
+    /**
+     * @return approximate count of pending messages.
+     */
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+        return mSize.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next = nullptr;
+        Message message;
+    };
+
+    /**
+     * @brief Last enqueued node. Producers' side.
+     */
+    alignas(64) std::atomic<Node*> mHead;
+    std::atomic_size_t mSize = 0;
+
+    /**
+     * @brief Stub node preceding the oldest message. Consumer's side.
+     */
+    alignas(64) Node* mTail;
+};
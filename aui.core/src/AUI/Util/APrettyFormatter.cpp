@@ -15,6 +15,7 @@
 
 #include "APrettyFormatter.h"
 #include <AUI/i18n/AI18n.h>
+#include <AUI/Common/AStringBuilder.h>
 
 AString APrettyFormatter::sizeInBytes(uint64_t b) {
     unsigned char postfix_level = 0;
@@ -24,25 +25,27 @@ AString APrettyFormatter::sizeInBytes(uint64_t b) {
         b = b / 1024;
         postfix_level++;
     }
-    auto n = AString::number(b / 10);
+    auto unit = [&] {
+        switch (postfix_level)
+        {
+            case 0:
+                return " b"_i18n;
+            case 1:
+                return " Kb"_i18n;
+            case 2:
+                return " Mb"_i18n;
+            case 3:
+                return " Gb"_i18n;
+            case 4:
+                return " Tb"_i18n;
+            case 5:
+                return " Pb"_i18n;
+            default:
+                return " ??"_i18n;
+        }
+    }();
     if (b % 10 != 0) {
-        n += "." + AString::number(b % 10);
-    }
-    switch (postfix_level)
-    {
-        case 0:
-            return n + " b"_i18n;
-        case 1:
-            return n + " Kb"_i18n;
-        case 2:
-            return n + " Mb"_i18n;
-        case 3:
-            return n + " Gb"_i18n;
-        case 4:
-            return n + " Tb"_i18n;
-        case 5:
-            return n + " Pb"_i18n;
-        default:
-            return n + " ??"_i18n;
+        return AStringBuilder::concat(b / 10, '.', b % 10, unit);
     }
+    return AStringBuilder::concat(b / 10, unit);
 }
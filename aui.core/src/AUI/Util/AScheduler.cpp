@@ -14,6 +14,7 @@
 //
 
 #include "AScheduler.h"
+#include <algorithm>
 
 
 AScheduler::AScheduler() {
@@ -23,29 +24,43 @@ AScheduler::AScheduler() {
 bool AScheduler::iteration(ABitField<ASchedulerIteration> flag) {
     std::unique_lock lock(mSync);
 
-    if (mTasks.empty()) {
+    if (emptyTasks()) {
         if (flag & ASchedulerIteration::DONT_BLOCK_INFINITELY) {
             return false;
         }
         mCV.wait(lock);
     }
 
-    while (!mTasks.empty()) {
+    while (!mHeap.empty()) {
         AThread::interruptionPoint();
         auto now = currentTime();
-        if (now < mTasks.front().executionTime) {
+        if (now + mTimerSlack < mHeap.front().executionTime) {
             if (flag & ASchedulerIteration::DONT_BLOCK_TIMED) {
                 return false;
             }
 
-            auto t = mTasks.front().executionTime;
+            auto t = mHeap.front().executionTime;
             mCV.wait_until(lock, t);
             break;
         }
-        auto callback = std::move(mTasks.front().callback);
-        mTasks.pop_front();
+        auto task = popTask();
+        if (task.timer) {
+            task.timer->scheduled = false;
+            if (task.timer->cancelled) {
+                mCancelledTimers -= 1;
+                continue;
+            }
+            lock.unlock();
+            task.timer->callback();
+            lock.lock();
+            if (!task.timer->cancelled) {
+                enqueueTimer(task.timer);
+            }
+            continue;
+        }
         lock.unlock();
-        callback();
+        task.callback();
+        task.callback = nullptr; // destroy captures outside of the lock
         lock.lock();
     }
 
@@ -67,15 +82,114 @@ void AScheduler::loop() {
 void AScheduler::removeTimer(const TimerHandle& t) {
     std::unique_lock lock(mSync);
     auto timer = t.lock();
-    if (!timer) {
+    if (!timer || timer->cancelled) {
         return;
     }
+    timer->cancelled = true;
+    if (timer->scheduled) {
+        mCancelledTimers += 1;
+        if (mCancelledTimers > mHeap.size() / 2) {
+            removeCancelledTimers();
+        }
+    }
+    mCV.notify_all();
+}
 
-    mTasks.erase(std::remove_if(mTasks.begin(), mTasks.end(), [&](const Task& rhs) {
-        return rhs.timer.lock() == timer;
-    }), mTasks.end());
-    if (auto it = std::find(mTimers.begin(), mTimers.end(), timer); it != mTimers.end()) {
-        mTimers.erase(it);
+void AScheduler::enqueueTimer(const _<Timer>& timer) {
+    auto executionTime = timer->nextExecution;
+    if (timer->slack.count() > 0) {
+        // align to the slack grid so timers with nearby deadlines share the same execution time.
+        auto slack = std::chrono::duration_cast<std::chrono::high_resolution_clock::duration>(timer->slack);
+        if (auto phase = executionTime.time_since_epoch() % slack; phase.count() != 0) {
+            executionTime += slack - phase;
+        }
     }
+    timer->nextExecution += timer->timeout;
+    timer->scheduled = true;
+    enqueueTask(executionTime, Task{ .callback = nullptr, .timer = timer });
+}
+
+void AScheduler::enqueueTask(std::chrono::high_resolution_clock::time_point executionTime, Task&& task) {
+    std::uint32_t slot;
+    if (!mFreeTaskSlots.empty()) {
+        slot = mFreeTaskSlots.back();
+        mFreeTaskSlots.pop_back();
+        mTaskSlots[slot] = std::move(task);
+    } else {
+        slot = static_cast<std::uint32_t>(mTaskSlots.size());
+        mTaskSlots.push_back(std::move(task));
+    }
+    mHeap.push_back({ .executionTime = executionTime, .order = mEnqueueCounter++, .slot = slot });
+    siftUp(mHeap.size() - 1);
     mCV.notify_all();
 }
+
+AScheduler::Task AScheduler::popTask() {
+    AUI_ASSERT(!mHeap.empty());
+    auto slot = mHeap.front().slot;
+    mHeap.front() = mHeap.back();
+    mHeap.pop_back();
+    if (!mHeap.empty()) {
+        siftDown(0);
+    }
+    auto task = std::move(mTaskSlots[slot]);
+    mFreeTaskSlots.push_back(slot);
+    return task;
+}
+
+void AScheduler::siftUp(std::size_t index) noexcept {
+    auto entry = mHeap[index];
+    while (index > 0) {
+        auto parent = (index - 1) / HEAP_ARITY;
+        if (!(entry < mHeap[parent])) {
+            break;
+        }
+        mHeap[index] = mHeap[parent];
+        index = parent;
+    }
+    mHeap[index] = entry;
+}
+
+void AScheduler::siftDown(std::size_t index) noexcept {
+    auto entry = mHeap[index];
+    for (;;) {
+        auto firstChild = index * HEAP_ARITY + 1;
+        if (firstChild >= mHeap.size()) {
+            break;
+        }
+        auto lastChild = std::min(firstChild + HEAP_ARITY, mHeap.size());
+        auto smallest = firstChild;
+        for (auto child = firstChild + 1; child < lastChild; ++child) {
+            if (mHeap[child] < mHeap[smallest]) {
+                smallest = child;
+            }
+        }
+        if (!(mHeap[smallest] < entry)) {
+            break;
+        }
+        mHeap[index] = mHeap[smallest];
+        index = smallest;
+    }
+    mHeap[index] = entry;
+}
+
+void AScheduler::removeCancelledTimers() {
+    std::erase_if(mHeap, [&](const HeapEntry& entry) {
+        auto& task = mTaskSlots[entry.slot];
+        if (task.timer && task.timer->cancelled) {
+            task.timer->scheduled = false;
+            task = {};
+            mFreeTaskSlots.push_back(entry.slot);
+            return true;
+        }
+        return false;
+    });
+    mCancelledTimers = 0;
+
+    // heapify
+    if (mHeap.size() > 1) {
+        for (auto i = (mHeap.size() - 2) / HEAP_ARITY + 1; i-- > 0;) {
+            siftDown(i);
+        }
+    }
+}
@@ -13,12 +13,14 @@
 
 #include <chrono>
 #include <functional>
-#include <list>
+#include <cstdint>
+#include <vector>
 #include "AUI/Reflect/AEnumerate.h"
 #include <AUI/Thread/AMutex.h>
 #include <AUI/Thread/AConditionVariable.h>
 #include <AUI/Thread/IEventLoop.h>
 #include <AUI/Util/ABitField.h>
+#include <AUI/Common/AMoveOnlyFunction.h>
 
 
 /**
@@ -54,6 +56,19 @@ AUI_ENUM_FLAG(ASchedulerIteration) {
 /**
  * @brief Basic scheduler used for timers.
  * @ingroup core
+ * @details
+ * Pending tasks are kept in a 4-ary min-heap ordered by execution time, so enqueueing a task or a timer costs
+ * O(log n) and picking the next task costs O(1). Timers are cancelled lazily: removeTimer() only marks the timer;
+ * cancelled entries are dropped when they reach the top of the heap or when they make up more than a half of the heap.
+ * Thus, starting and stopping thousands of timers does not involve linear scans.
+ *
+ * Nearby deadlines can be coalesced into a single wakeup in two ways:
+ * - a timer created with a slack is executed at the first multiple of its slack (counted from the clock's epoch) not
+ *   earlier than its deadline, i.e., it is delayed by less than the slack, never executed earlier. Timers with the same
+ *   slack (or slacks which are multiples of each other) whose deadlines fall within the same slack interval share a
+ *   wakeup;
+ * - tasks whose execution time falls within the scheduler-wide timer slack (see setTimerSlack(), zero by default) of
+ *   the current wakeup are executed during the same wakeup, possibly earlier than requested.
  */
 class API_AUI_CORE AScheduler: public IEventLoop {
 private:
@@ -63,12 +78,47 @@ private:
         std::chrono::milliseconds timeout;
         std::chrono::high_resolution_clock::time_point nextExecution;
         std::function<void()> callback;
+
+        /**
+         * @brief Max delay of the execution used to coalesce the timer with nearby ones; zero for exact timers.
+         */
+        std::chrono::microseconds slack;
+
+        /**
+         * @brief Set by removeTimer(). Guarded by mSync.
+         */
+        bool cancelled = false;
+
+        /**
+         * @brief Whether the timer has an entry in the heap. Guarded by mSync.
+         */
+        bool scheduled = false;
     };
 
     struct Task {
+        AMoveOnlyFunction<void()> callback;
+        _<Timer> timer;
+    };
+
+    struct HeapEntry {
         std::chrono::high_resolution_clock::time_point executionTime;
-        std::function<void()> callback;
-        _weak<Timer> timer;
+
+        /**
+         * @brief Enqueue order; keeps FIFO order of tasks with the same execution time.
+         */
+        std::uint64_t order;
+
+        /**
+         * @brief Index in mTaskSlots.
+         */
+        std::uint32_t slot;
+
+        bool operator<(const HeapEntry& rhs) const noexcept {
+            if (executionTime != rhs.executionTime) {
+                return executionTime < rhs.executionTime;
+            }
+            return order < rhs.order;
+        }
     };
 public:
     using TimerHandle = _weak<Timer>;
@@ -86,13 +136,10 @@ public:
     void loop() override;
 
     template<typename Duration>
-    void enqueue(Duration timeout, std::function<void()> callback) {
+    void enqueue(Duration timeout, AMoveOnlyFunction<void()> callback) {
         std::unique_lock lock(mSync);
-        Task asTask = {
-                std::chrono::duration_cast<SchedulerDuration>(timeout) + currentTime(),
-                std::move(callback)
-        };
-        enqueueTask(std::move(asTask));
+        enqueueTask(std::chrono::duration_cast<SchedulerDuration>(timeout) + currentTime(),
+                    Task{ .callback = std::move(callback), .timer = nullptr });
         mCV.notify_all();
     }
 
@@ -100,32 +147,39 @@ public:
      * @brief Creates a timer.
      * @param timeout timeout (i.e. 500ms)
      * @param callback callback to be called
+     * @param slack max delay of each execution which the scheduler may use to coalesce the timer with nearby ones.
      * @return timer instance which can be used to remove the timer.
      * @details
      * Creates a timer with the specified callback. The callback is not called immediately during timer creation.
+     *
+     * With a nonzero slack, each execution is aligned to the first multiple of the slack not earlier than the
+     * deadline. The alignment does not accumulate: the next deadline is still counted from the unaligned one.
      */
     template<typename Duration>
-    TimerHandle timer(Duration timeout, std::function<void()> callback) {
+    TimerHandle timer(Duration timeout, std::function<void()> callback, std::chrono::microseconds slack = {}) {
         auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(timeout);
-        Timer t = {
-                millis,
-                millis + currentTime(),
-                std::move(callback)
-        };
-        auto asTimer = _new<Timer>(std::move(t));
+        auto asTimer = _new<Timer>(Timer {
+                .timeout = millis,
+                .nextExecution = millis + currentTime(),
+                .callback = std::move(callback),
+                .slack = slack,
+        });
 
         std::unique_lock lock(mSync);
-        mTimers.push_back(asTimer);
         enqueueTimer(asTimer);
         return asTimer;
     }
 
-
+    /**
+     * @brief Cancels the timer.
+     * @details
+     * Amortized O(1).
+     */
     void removeTimer(const TimerHandle& t);
 
     [[nodiscard]]
     bool emptyTasks() const noexcept {
-        return mTasks.empty();
+        return mHeap.size() == mCancelledTimers;
     }
 
     void stop() {
@@ -133,41 +187,50 @@ public:
         mCV.notify_all();
     }
 
+    /**
+     * @brief Sets timer slack.
+     * @details
+     * Tasks whose execution time is within the slack from the current time are executed during the same wakeup,
+     * possibly a bit earlier than requested. Larger slack reduces count of wakeups when many timers are used.
+     * Unlike the slack of a timer (see timer()), it applies to all tasks and timers of the scheduler.
+     *
+     * Default value is 0, i.e., tasks are never executed earlier than requested.
+     */
+    void setTimerSlack(std::chrono::microseconds slack) noexcept {
+        mTimerSlack = slack;
+    }
+
+    [[nodiscard]]
+    std::chrono::microseconds timerSlack() const noexcept {
+        return mTimerSlack;
+    }
 
 private:
+    static constexpr std::size_t HEAP_ARITY = 4;
+
     AMutex mSync;
     AConditionVariable mCV;
     bool mIsRunning = false;
+    std::chrono::microseconds mTimerSlack{0};
+
+    std::vector<HeapEntry> mHeap;
+    std::vector<Task> mTaskSlots;
+    std::vector<std::uint32_t> mFreeTaskSlots;
+    std::uint64_t mEnqueueCounter = 0;
 
-    std::list<Task> mTasks;
-    std::list<_<Timer>> mTimers;
+    /**
+     * @brief Count of heap entries which belong to cancelled timers.
+     */
+    std::size_t mCancelledTimers = 0;
 
     static std::chrono::high_resolution_clock::time_point currentTime() noexcept {
         return std::chrono::high_resolution_clock::now();
     }
 
-    void enqueueTimer(const _<Timer>& timer) {
-        Task t = {
-                timer->nextExecution,
-                [this, timer]() {
-                    timer->callback();
-                    std::unique_lock lock(mSync);
-                    enqueueTimer(timer);
-                },
-                timer
-        };
-        timer->nextExecution += timer->timeout;
-        enqueueTask(std::move(t));
-    }
-
-
-    void enqueueTask(Task&& asTask) {
-        auto whereToInsert = std::find_if(mTasks.begin(), mTasks.end(), [&](const Task& rhs) {
-            return asTask.executionTime < rhs.executionTime;
-        });
-
-        mTasks.insert(whereToInsert, std::move(asTask));
-        mCV.notify_all();
-    }
-
+    void enqueueTimer(const _<Timer>& timer);
+    void enqueueTask(std::chrono::high_resolution_clock::time_point executionTime, Task&& task);
+    Task popTask();
+    void siftUp(std::size_t index) noexcept;
+    void siftDown(std::size_t index) noexcept;
+    void removeCancelledTimers();
 };
@@ -23,6 +23,11 @@ ATokenizer::ATokenizer(const AString& fromString):
 {
 }
 
+ATokenizer::ATokenizer(std::string utf8):
+    mInput(_new<AStringStream>(std::move(utf8)))
+{
+}
+
 const std::string& ATokenizer::readString()
 {
     mTemporaryStringBuffer.clear();
@@ -33,6 +33,15 @@ public:
 
     explicit ATokenizer(const AString& fromString);
 
+    /**
+     * @brief Tokenizes UTF-8 string as is, without transcoding.
+     * @details
+     * Accepts AUtf8String, std::string and string literals.
+     */
+    explicit ATokenizer(std::string utf8);
+
+    explicit ATokenizer(const char* utf8): ATokenizer(std::string(utf8)) {}
+
     /**
      * @brief Reads string while isalnum == true.
      * @return read string
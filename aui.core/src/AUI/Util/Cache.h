@@ -12,14 +12,14 @@
 #pragma once
 
 #include "AUI/Common/AString.h"
-#include "AUI/Common/AMap.h"
+#include "AUI/Common/AFlatHashMap.h"
 #include "AUI/Common/SharedPtr.h"
 #include "AUI/Thread/AMutex.h"
 
 template<typename T, typename Container, typename K = AString>
 class Cache {
 private:
-    AMap<K, _<T>> mContainer;
+    AFlatHashMap<K, _<T>> mContainer;
     AMutex mSync;
 
 protected:
@@ -47,7 +47,7 @@ AI18n::AI18n() {
     }
 }
 
-void AI18n::loadFromStreamInto(const _<IInputStream>& iis, AMap<AString, AString>& langData) {
+void AI18n::loadFromStreamInto(const _<IInputStream>& iis, AFlatHashMap<AString, AString>& langData) {
     ATokenizer t(iis);
     bool running = true;
     try {
@@ -16,7 +16,7 @@
 #pragma once
 
 #include <AUI/Common/AString.h>
-#include <AUI/Common/AMap.h>
+#include <AUI/Common/AFlatHashMap.h>
 #include <AUI/IO/IInputStream.h>
 #include "ALanguageCode.h"
 
@@ -27,9 +27,9 @@
 class API_AUI_CORE AI18n {
     friend class Lang;
 private:
-    AMap<AString, AString> mLangData;
+    AFlatHashMap<AString, AString> mLangData;
 
-    static void loadFromStreamInto(const _<IInputStream>& iis, AMap<AString, AString>& langData);
+    static void loadFromStreamInto(const _<IInputStream>& iis, AFlatHashMap<AString, AString>& langData);
 public:
     AI18n();
 
@@ -40,7 +40,7 @@ public:
 
     static ALanguageCode userLanguage();
 
-    const AMap<AString, AString>& getLangData() const {
+    const AFlatHashMap<AString, AString>& getLangData() const {
         return mLangData;
     }
 };
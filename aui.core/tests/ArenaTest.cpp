@@ -0,0 +1,121 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <AUI/Common/AArena.h>
+#include <AUI/Common/AByteBuffer.h>
+
+namespace {
+    /**
+     * Counts chunks requested from upstream.
+     */
+    struct CountingResource: std::pmr::memory_resource {
+        std::size_t allocations = 0;
+        std::size_t deallocations = 0;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+            ++deallocations;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    };
+}
+
+TEST(Arena, Alignment) {
+    AArena arena(256);
+    for (std::size_t alignment : { 1, 2, 4, 8, 16, 64 }) {
+        auto p = arena.allocate(3, alignment);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignment, 0) << "alignment " << alignment;
+    }
+    EXPECT_NE(arena.allocate(0), nullptr);
+
+    // larger than a chunk
+    auto big = static_cast<char*>(arena.allocate(10000, 32));
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big) % 32, 0);
+    std::memset(big, 0, 10000);
+}
+
+TEST(Arena, ResetKeepsLargestChunk) {
+    CountingResource upstream;
+    {
+        AArena arena(1024, &upstream);
+        for (int i = 0; i < 1000; ++i) {
+            ASSERT_NE(arena.allocate(100), nullptr);
+        }
+        auto chunks = upstream.allocations;
+        EXPECT_GT(chunks, 1);
+        EXPECT_EQ(arena.bytesAllocated(), 100'000);
+
+        arena.reset();
+        EXPECT_EQ(arena.bytesAllocated(), 0);
+        EXPECT_EQ(upstream.deallocations, chunks - 1);
+
+        // the kept chunk can't hold all 100'000 bytes, so the first cycle allocates one larger chunk. reset() keeps
+        // that chunk, and the remaining cycles fit in it.
+        for (int cycle = 0; cycle < 3; ++cycle) {
+            for (int i = 0; i < 1000; ++i) {
+                ASSERT_NE(arena.allocate(100), nullptr);
+            }
+            arena.reset();
+        }
+        EXPECT_EQ(upstream.allocations, chunks + 1);
+        EXPECT_EQ(upstream.allocations - upstream.deallocations, 1);
+
+        arena.release();
+        EXPECT_EQ(arena.bytesReserved(), 0);
+        EXPECT_EQ(upstream.deallocations, upstream.allocations);
+    }
+    EXPECT_EQ(upstream.deallocations, upstream.allocations);
+}
+
+TEST(Arena, Containers) {
+    CountingResource upstream;
+    AArena arena(1024, &upstream);
+
+    aui::pmr::AVector<aui::pmr::AVector<int>> vectors(&arena);
+    for (int i = 0; i < 100; ++i) {
+        auto& v = vectors.emplace_back();
+        // nested containers get the arena too.
+        EXPECT_EQ(v.get_allocator().resource(), &arena);
+        for (int j = 0; j < i; ++j) {
+            v << j;
+        }
+    }
+    EXPECT_EQ(vectors[99].size(), 99);
+    EXPECT_EQ(vectors[99].last(), 98);
+
+    // copies do not refer to the arena.
+    aui::pmr::AVector<int> copy = vectors[99];
+    EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+
+    AByteBuffer buffer(&arena);
+    for (int i = 0; i < 1000; ++i) {
+        buffer << i;
+    }
+    EXPECT_EQ(buffer.resource(), &arena);
+    EXPECT_EQ(buffer.size(), 1000 * sizeof(int));
+    EXPECT_EQ(buffer.at<int>(999 * sizeof(int)), 999);
+
+    AByteBuffer moved = std::move(buffer);
+    EXPECT_EQ(moved.resource(), &arena);
+    EXPECT_EQ(moved.at<int>(0), 0);
+
+    EXPECT_EQ(AByteBuffer(moved).resource(), std::pmr::get_default_resource());
+    EXPECT_GT(upstream.allocations, 0);
+}
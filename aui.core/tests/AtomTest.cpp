@@ -0,0 +1,78 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <AUI/Common/AAtomVector.h>
+#include <AUI/Common/AVector.h>
+
+TEST(Atom, Interning) {
+    AAtom a(".btn");
+    AAtom b { AString(".btn") };
+    AAtom c(u".btn");
+    EXPECT_EQ(&a.str(), &b.str());
+    EXPECT_EQ(&a.str(), &c.str());
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, AAtom(".label"));
+
+    EXPECT_EQ(a, ".btn"_as);
+    EXPECT_EQ(".btn"_as, a);
+    EXPECT_EQ(a, ".btn");
+    EXPECT_EQ(a.hash(), std::hash<AString>()(".btn"));
+}
+
+TEST(Atom, Empty) {
+    EXPECT_TRUE(AAtom().empty());
+    EXPECT_EQ(AAtom(), AAtom(""));
+    EXPECT_EQ(AAtom().hash(), std::hash<AString>()(""));
+}
+
+TEST(Atom, Vector) {
+    AAtomVector names = { AAtom(".btn"), AAtom(".accent") };
+    EXPECT_TRUE(names.contains(AAtom(".accent")));
+    EXPECT_TRUE(names.contains(".accent"));
+    EXPECT_FALSE(names.contains(AAtom(".label")));
+
+    // lookups by strings don't intern them.
+    EXPECT_FALSE(names.contains(".vector-missing"));
+    EXPECT_FALSE(AAtom::find(".vector-missing"));
+}
+
+TEST(Atom, Find) {
+    AAtom interned(".find-interned");
+    EXPECT_EQ(AAtom::find(".find-interned"), interned);
+    EXPECT_EQ(AAtom::find(""), AAtom());
+
+    // find() never interns.
+    EXPECT_FALSE(AAtom::find(".find-missing"));
+    EXPECT_FALSE(AAtom::find(".find-missing"));
+}
+
+TEST(Atom, Concurrent) {
+    // all threads must end up with the same entries.
+    static constexpr auto THREADS = 4;
+    static constexpr auto ATOMS = 1000;
+    AVector<AVector<const AString*>> results(THREADS);
+    AVector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < ATOMS; ++i) {
+                results[t] << &AAtom("atom_test_" + AString::number(i)).str();
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    for (int t = 1; t < THREADS; ++t) {
+        EXPECT_EQ(results[t], results[0]);
+    }
+}
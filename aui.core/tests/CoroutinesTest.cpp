@@ -23,7 +23,7 @@ using namespace std::chrono_literals;
 
 
 
-AFuture<int> longTask() {
+static AFuture<int> longTask() {
     return async {
         AThread::sleep(10ms); // long tamssk
         return 228;
@@ -39,7 +39,7 @@ TEST(Coroutines, CoAwait) {
     EXPECT_EQ(v, 228 + 322);
 }
 
-AFuture<int> longTaskException() {
+static AFuture<int> longTaskException() {
     return async -> int {
         AThread::sleep(10ms); // long tamssk
         throw AException("Whoops! Something bad happened");
@@ -54,4 +54,51 @@ TEST(Coroutines, CoAwaitException) {
     EXPECT_ANY_THROW(*future);
 }
 
+TEST(Coroutines, SwitchExecutor) {
+    AThreadPool localThreadPool(2);
+    AFuture<int> input;
+    auto future = [&]() -> AFuture<bool> {
+        co_await aui::on(localThreadPool);
+        bool startedOnPool = AThreadPool::Worker::currentWorker() != nullptr;
+
+        // the value is supplied by an unrelated thread; the coroutine must come back to the pool.
+        auto v = co_await input;
+        bool resumedOnPool = AThreadPool::Worker::currentWorker() != nullptr &&
+                             &AThreadPool::Worker::currentWorker()->threadPool() == &localThreadPool;
+        co_return startedOnPool && resumedOnPool && v == 42;
+    }();
+    auto supplier = _new<AThread>([&] {
+        AThread::sleep(10ms);
+        input.supplyValue(42);
+    });
+    supplier->start();
+    EXPECT_TRUE(*future);
+    supplier->join();
+}
+
+static AFuture<> longTaskVoid() {
+    return async {
+        AThread::sleep(1ms);
+    };
+}
+
+TEST(Coroutines, CoAwaitVoid) {
+    int counter = 0;
+    auto future = [&]() -> AFuture<> {
+        co_await longTaskVoid();
+        counter++;
+        co_return;
+    }();
+    future.wait();
+    EXPECT_EQ(counter, 1);
+}
+
+TEST(Coroutines, FrameRecycling) {
+    using Allocator = aui::impl::future::CoroutineFrameAllocator;
+    auto frame = Allocator::allocate(200);
+    Allocator::deallocate(frame, 200);
+    EXPECT_EQ(Allocator::allocate(250), frame); // same size class
+    Allocator::deallocate(frame, 250);
+}
+
 #endif
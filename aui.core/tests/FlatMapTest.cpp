@@ -0,0 +1,261 @@
+/*
+ * AUI Framework - Declarative UI toolkit for modern C++20
+ * Copyright (C) 2020-2025 Alex2772 and Contributors
+ *
+ * SPDX-License-Identifier: MPL-2.0
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <gtest/gtest.h>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+#include <AUI/Common/AFlatHashMap.h>
+#include <AUI/Common/AFlatHashSet.h>
+#include <AUI/Common/AFlatMap.h>
+#include <AUI/Common/AString.h>
+#include <AUI/Common/SharedPtr.h>
+
+TEST(FlatHashMap, Basic) {
+    AFlatHashMap<AString, int> map;
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.find("missing") == map.end());
+    EXPECT_TRUE(map.begin() == map.end());
+
+    map["one"] = 1;
+    map["two"] = 2;
+    EXPECT_TRUE(map.insert({ "three", 3 }).second);
+    EXPECT_FALSE(map.insert({ "three", 33 }).second);
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map["three"], 3);
+
+    EXPECT_EQ(map.erase("two"), 1);
+    EXPECT_EQ(map.erase("two"), 0);
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_FALSE(map.contains("two"));
+}
+
+TEST(FlatHashMap, BaseMapExtensions) {
+    AFlatHashMap<AString, int> map = { { "one", 1 }, { "two", 2 } };
+
+    if (auto c = map.contains("one")) {
+        EXPECT_EQ(c->second, 1);
+    } else {
+        FAIL() << "one is expected to be found";
+    }
+    EXPECT_EQ(map.optional("two"), 2);
+    EXPECT_EQ(map.optional("three"), std::nullopt);
+    EXPECT_THROW(map.at("three"), AException);
+
+    const auto& constMap = map;
+    EXPECT_EQ(constMap["one"], 1);
+
+    int factoryCalls = 0;
+    map.getOrInsert("three", [&] { ++factoryCalls; return 3; });
+    map.getOrInsert("three", [&] { ++factoryCalls; return 33; });
+    EXPECT_EQ(factoryCalls, 1);
+    EXPECT_EQ(map["three"], 3);
+
+    auto values = map.valueVector();
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(values, (AVector<int>{ 1, 2, 3 }));
+}
+
+TEST(FlatHashMap, MatchesUnorderedMap) {
+    // random inserts and erases to exercise growth, tombstones and their reuse.
+    AFlatHashMap<int, int> map;
+    std::unordered_map<int, int> reference;
+    std::mt19937 random(0);
+    for (int i = 0; i < 100'000; ++i) {
+        int key = random() % 2000;
+        if (random() % 3 == 0) {
+            EXPECT_EQ(map.erase(key), reference.erase(key));
+        } else {
+            map[key] = i;
+            reference[key] = i;
+        }
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    for (const auto& [key, value] : reference) {
+        auto it = map.find(key);
+        ASSERT_TRUE(it != map.end());
+        EXPECT_EQ(it->second, value);
+    }
+    std::size_t iterated = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(reference.at(key), value);
+        ++iterated;
+    }
+    EXPECT_EQ(iterated, reference.size());
+}
+
+TEST(FlatHashMap, EraseWhileIterating) {
+    AFlatHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i) {
+        map[i] = i;
+    }
+    for (auto it = map.begin(); it != map.end();) {
+        if (it->first % 2 == 0) {
+            it = map.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    EXPECT_EQ(map.size(), 50);
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(key % 2, 1);
+    }
+}
+
+TEST(FlatHashMap, CopyMoveDestroy) {
+    _weak<int> weak;
+    {
+        AFlatHashMap<int, _<int>> map;
+        for (int i = 0; i < 100; ++i) {
+            map[i] = _new<int>(i);
+        }
+        weak = map[42].weak();
+
+        auto copy = map;
+        EXPECT_TRUE(copy == map);
+        EXPECT_EQ(*copy[42], 42);
+
+        auto moved = std::move(copy);
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(moved.size(), 100);
+
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_FALSE(weak.expired());
+
+        moved = map;
+        EXPECT_TRUE(moved.empty());
+    }
+    EXPECT_TRUE(weak.expired());
+}
+
+TEST(FlatHashSet, Basic) {
+    AFlatHashSet<AString> set;
+    set << "one" << "two" << "two";
+    EXPECT_EQ(set.size(), 2);
+    EXPECT_TRUE(set.contains("one"));
+    EXPECT_FALSE(set.contains("three"));
+
+    set >> "one";
+    EXPECT_FALSE(set.contains("one"));
+
+    set << AVector<AString>{ "three", "four" };
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.isSubsetOf(AVector<AString>{ "two", "four" }));
+}
+
+TEST(FlatMap, Sorted) {
+    AFlatMap<AString, int> map = { { "c", 3 }, { "a", 1 }, { "b", 2 }, { "a", 11 } };
+    // the first of the equal keys is kept, as for AMap.
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map["a"], 1);
+    EXPECT_EQ(map.keyVector(), (AVector<AString>{ "a", "b", "c" }));
+
+    map["0"] = 0;
+    map.insert({ { "d", 4 }, { "b", 22 } });
+    EXPECT_EQ(map.keyVector(), (AVector<AString>{ "0", "a", "b", "c", "d" }));
+    EXPECT_EQ(map["b"], 2);
+
+    EXPECT_EQ(map.erase("c"), 1);
+    EXPECT_EQ(map.erase("c"), 0);
+    EXPECT_EQ(map.valueVector(), (AVector<int>{ 0, 1, 2, 4 }));
+    EXPECT_THROW(map.at("c"), AException);
+    EXPECT_EQ(map.optional("d"), 4);
+}
+
+TEST(FlatMap, ConstKeys) {
+    // keys can't be modified through iterators, as for AMap.
+    using Element = std::pair<const AString, int>;
+    static_assert(std::is_same_v<AFlatMap<AString, int>::value_type, Element>);
+    static_assert(std::is_same_v<decltype(*std::declval<AFlatMap<AString, int>::iterator>()), Element&>);
+    static_assert(std::is_same_v<AFlatHashMap<AString, int>::value_type, Element>);
+    static_assert(std::is_same_v<decltype(*std::declval<AFlatHashMap<AString, int>::iterator>()), Element&>);
+
+    AFlatMap<AString, int> map = { { "b", 2 }, { "a", 1 } };
+    for (auto& [key, value] : map) {
+        value *= 10;
+    }
+    EXPECT_EQ(map.valueVector(), (AVector<int>{ 10, 20 }));
+    EXPECT_EQ(std::prev(map.end())->first, "b");
+    EXPECT_EQ(map.end() - map.begin(), 2);
+
+    // rehashing moves the keys.
+    AFlatHashMap<_unique<int>, int> owners;
+    for (int i = 0; i < 100; ++i) {
+        owners.try_emplace(std::make_unique<int>(i), i);
+    }
+    EXPECT_EQ(owners.size(), 100);
+    for (const auto& [key, value] : owners) {
+        EXPECT_EQ(*key, value);
+    }
+
+    // pairs which are not standard layout have their keys copied instead.
+    AFlatMap<AString, std::function<int()>> functions;
+    AFlatHashMap<AString, std::function<int()>> hashedFunctions;
+    for (int i = 0; i < 100; ++i) {
+        functions[AString::number(99 - i)] = [i] { return 99 - i; };
+        hashedFunctions[AString::number(i)] = [i] { return i; };
+    }
+    for (const auto& [key, value] : functions) {
+        EXPECT_EQ(key.toInt(), value());
+    }
+    for (const auto& [key, value] : hashedFunctions) {
+        EXPECT_EQ(key.toInt(), value());
+    }
+}
+
+namespace {
+    /**
+     * The move constructor is not noexcept, so rehashing copies the elements.
+     */
+    struct ThrowingCopy {
+        static inline int copiesLeft = 0;
+        int value;
+
+        ThrowingCopy(int value): value(value) {}
+        ThrowingCopy(const ThrowingCopy& other): value(other.value) {
+            if (copiesLeft-- == 0) {
+                throw std::runtime_error("copy");
+            }
+        }
+        ThrowingCopy(ThrowingCopy&& other) noexcept(false): value(other.value) {}
+    };
+}
+
+TEST(FlatMap, ThrowingRehash) {
+    AFlatHashMap<int, ThrowingCopy> map;
+    map.reserve(1);
+    auto capacity = map.capacity();
+    int count = 0;
+    while (map.size() < capacity - capacity / 8) {
+        map.try_emplace(count, count);
+        ++count;
+    }
+    EXPECT_EQ(map.capacity(), capacity);
+
+    ThrowingCopy::copiesLeft = 3;
+    EXPECT_THROW(map.try_emplace(count, count), std::runtime_error);
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_EQ(map.size(), count);
+    for (int i = 0; i < count; ++i) {
+        EXPECT_EQ(map.at(i).value, i);
+    }
+
+    ThrowingCopy::copiesLeft = 1'000;
+    map.try_emplace(count, count);
+    EXPECT_GT(map.capacity(), capacity);
+    EXPECT_EQ(map.size(), count + 1);
+    for (int i = 0; i <= count; ++i) {
+        EXPECT_EQ(map.at(i).value, i);
+    }
+}
@@ -153,6 +153,77 @@ TEST_F(PropertyPrecomputedTest, Evaluation_Loop) {
     EXPECT_THROW({**v1;}, AEvaluationLoopException);
 }
 
+// # Batching
+// Each change of a dependency invalidates `APropertyPrecomputed` immediately. When several dependencies are changed in
+// a row, or derived properties form a diamond, the expression is re-evaluated per change and observers might see a
+// value computed from partially updated inputs. Use `aui::react::batch` to make the updates a single transaction:
+// derived properties are recomputed and emit `changed` once each, in dependency order.
+TEST_F(PropertyPrecomputedTest, Batch) {
+    AProperty<int> a = 1;
+    AProperty<int> b = 2;
+    int leftEvaluations = 0, rightEvaluations = 0, bottomEvaluations = 0;
+    APropertyPrecomputed<int> left = [&] { ++leftEvaluations; return a * 10; };
+    APropertyPrecomputed<int> right = [&] { ++rightEvaluations; return a + b; };
+    APropertyPrecomputed<int> bottom = [&] { ++bottomEvaluations; return left - right; };
+    EXPECT_EQ(*bottom, 7);
+    EXPECT_EQ(bottom.height(), 2);
+
+    AVector<int> observed;
+    auto observer = _new<AObject>();
+    AObject::connect(bottom.changed, observer, [&](int v) { observed << v; });
+    leftEvaluations = rightEvaluations = bottomEvaluations = 0;
+
+    // AUI_DOCS_CODE_BEGIN
+    aui::react::batch([&] {
+        a = 2;
+        b = 3;
+    });
+    // AUI_DOCS_CODE_END
+    EXPECT_EQ(observed, AVector<int>{15});
+    EXPECT_EQ(leftEvaluations, 1);
+    EXPECT_EQ(rightEvaluations, 1);
+    EXPECT_EQ(bottomEvaluations, 1);
+
+    // without a batch, the diamond bottom is evaluated per path, and observers see a glitch: a value computed from
+    // partially updated inputs.
+    observed.clear();
+    bottomEvaluations = 0;
+    a = 3;
+    EXPECT_EQ(*bottom, 24);
+    EXPECT_EQ(bottomEvaluations, 2);
+    EXPECT_EQ(observed.size(), 2);
+    EXPECT_EQ(observed.last(), 24);
+}
+
+TEST_F(PropertyPrecomputedTest, BatchThrowingExpression) {
+    AProperty<int> a = 1;
+    AProperty<int> b = 1;
+    APropertyPrecomputed<int> throwing = [&] {
+        if (a == 2) {
+            throw AException("expected");
+        }
+        return *a;
+    };
+    APropertyPrecomputed<int> other = [&] { return a + 1; };
+    EXPECT_EQ(*throwing, 1);
+    EXPECT_EQ(*other, 2);
+
+    AVector<int> observed;
+    auto observer = _new<AObject>();
+    AObject::connect(throwing.changed, observer, [](int) {});
+    AObject::connect(other.changed, observer, [&](int v) { observed << v; });
+
+    EXPECT_THROW(aui::react::batch([&] { a = 2; }), AException);
+    EXPECT_TRUE(observed.empty());
+
+    // the failed batch must not leave queued observers behind.
+    aui::react::batch([&] { b = 2; });
+    EXPECT_TRUE(observed.empty());
+
+    aui::react::batch([&] { a = 3; });
+    EXPECT_EQ(observed, AVector<int>{4});
+}
+
 // # Copying and moving APropertyPrecomputed
 // @warning
 // Despite the underlying value and factory callback are both copy constructible and movable, the **copy and move
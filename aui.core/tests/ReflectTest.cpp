@@ -15,7 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <AUI/Common/AString.h>
-#include <AUI/Common/AMap.h>
+#include <AUI/Common/AFlatMap.h>
 #include <AUI/Reflect/AClass.h>
 #include <AUI/Reflect/AEnumerate.h>
 #include <AUI/Reflect/AReflect.h>
@@ -91,7 +91,7 @@ TEST(Reflect, NameStruct) { ASSERT_EQ(AClass<MyStruct>::name(), "MyStruct"); }
 TEST(Reflect, NameEnum) { ASSERT_EQ((AClass<ATest>::name()), "ATest"); }
 
 TEST(Reflect, EnumerateAll) {
-    AMap<AString, ATest> ref = {
+    AFlatMap<AString, ATest> ref = {
         { "VALUE1", VALUE1 },
         { "VALUE2", VALUE2 },
         { "VALUE3", VALUE3 },
@@ -103,7 +103,7 @@ TEST(Reflect, EnumerateAll) {
 }
 
 TEST(Reflect, NamespaceEnumerateNames) {
-    AMap<AString, namespaceeee::ATest> ref = {
+    AFlatMap<AString, namespaceeee::ATest> ref = {
         { "V1", namespaceeee::V1 },
         { "V2", namespaceeee::V2 },
         { "V3", namespaceeee::V3 },
@@ -113,7 +113,7 @@ TEST(Reflect, NamespaceEnumerateNames) {
 }
 
 TEST(Reflect, NamespaceEnumerateEnumClassNames) {
-    AMap<AString, namespaceeee::ATest2> ref = {
+    AFlatMap<AString, namespaceeee::ATest2> ref = {
         { "TEST2_1", namespaceeee::ATest2::TEST2_1 },
         { "TEST2_2", namespaceeee::ATest2::TEST2_2 },
         { "TEST2_3", namespaceeee::ATest2::TEST2_3 },
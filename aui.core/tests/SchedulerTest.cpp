@@ -14,8 +14,10 @@
 //
 
 #include <gtest/gtest.h>
+#include <thread>
 #include "AUI/Thread/AThread.h"
 #include "AUI/Util/AScheduler.h"
+#include "AUI/Common/ATimer.h"
 #include "AUI/Traits/iterators.h"
 
 
@@ -136,3 +138,100 @@ TEST(Scheduler, TimerCancellation) {
         1000ms,
     });
 }
+
+TEST(Scheduler, EnqueueOrder) {
+    AScheduler scheduler;
+    AVector<int> order;
+
+    scheduler.enqueue(300ms, [&] { order << 3; });
+    scheduler.enqueue(100ms, [&] { order << 1; });
+    scheduler.enqueue(200ms, [&] { order << 2; });
+    scheduler.enqueue(0ms, [&] { order << 0; });
+
+    while (!scheduler.emptyTasks()) {
+        scheduler.iteration();
+    }
+
+    EXPECT_EQ(order, (AVector<int>{ 0, 1, 2, 3 }));
+}
+
+TEST(Scheduler, ManyTimersCancellation) {
+    AScheduler scheduler;
+    int calls = 0;
+
+    AVector<AScheduler::TimerHandle> timers;
+    for (int i = 0; i < 10000; ++i) {
+        timers << scheduler.timer(50ms, [&] { calls += 1; });
+    }
+    // keep the last one
+    for (std::size_t i = 0; i + 1 < timers.size(); ++i) {
+        scheduler.removeTimer(timers[i]);
+    }
+    EXPECT_FALSE(scheduler.emptyTasks());
+
+    AThread::sleep(60ms);
+    scheduler.iteration(ASchedulerIteration::DONT_BLOCK);
+    EXPECT_EQ(calls, 1);
+
+    scheduler.removeTimer(timers.last());
+    EXPECT_TRUE(scheduler.emptyTasks());
+}
+
+TEST(Scheduler, TimerSlack) {
+    AScheduler scheduler;
+    scheduler.setTimerSlack(50ms);
+    TimeLog log;
+
+    scheduler.enqueue(100ms, [&] { log.push(); });
+    scheduler.enqueue(120ms, [&] { log.push(); });
+
+    // both deadlines are coalesced into a single wakeup.
+    scheduler.iteration(); // wait for the first deadline
+    scheduler.iteration(ASchedulerIteration::DONT_BLOCK);
+
+    log.compare({
+        100ms,
+        100ms,
+    });
+}
+
+TEST(Scheduler, TimerSlackPerTimer) {
+    AScheduler scheduler;
+
+    // start right after a boundary of the slack grid so both deadlines fall within the same slack interval.
+    constexpr auto SLACK = 200ms;
+    auto phase = high_resolution_clock::now().time_since_epoch() % SLACK;
+    std::this_thread::sleep_for(SLACK - phase);
+
+    TimeLog log;
+    AVector<AScheduler::TimerHandle> timers;
+    timers << scheduler.timer(100ms, [&] { log.push(); }, SLACK);
+    timers << scheduler.timer(150ms, [&] { log.push(); }, SLACK);
+
+    // both timers are delayed to the same wakeup, none of them is executed earlier than requested.
+    scheduler.iteration(); // wait for the slack boundary
+    scheduler.iteration(ASchedulerIteration::DONT_BLOCK);
+
+    ASSERT_EQ(log.size(), 2);
+    EXPECT_GE(log[0] - log.mBegin, 150ms);
+    EXPECT_LT(log[1] - log[0], 10ms);
+    log.compare({
+        200ms,
+        200ms,
+    });
+
+    for (const auto& timer : timers) {
+        scheduler.removeTimer(timer);
+    }
+}
+
+TEST(Scheduler, TimerDefaultSlack) {
+    EXPECT_EQ(ATimer(10ms).slack(), 0ms);
+    EXPECT_EQ(ATimer(100ms).slack(), 4ms);
+    EXPECT_EQ(ATimer(500ms).slack(), 16ms);
+    EXPECT_EQ(ATimer(1s).slack(), 32ms);
+
+    ATimer exact(1s);
+    exact.setSlack(0ms);
+    EXPECT_EQ(exact.slack(), 0ms);
+}
@@ -20,6 +20,7 @@
 #include <AUI/Common/AString.h>
 #include <AUI/Util/kAUI.h>
 #include <gmock/gmock.h>
+#include <array>
 #include <random>
 
 using namespace std::chrono_literals;
@@ -322,6 +323,69 @@ TEST_F(SignalSlotTest, ObjectDestroySlaveInSignalHandler) {
     }
 }
 
+/**
+ * Destroys master in a signal handler; the following handlers of the same emission disconnect and destroy their
+ * receivers, which must not touch the destroyed signal.
+ */
+TEST_F(SignalSlotTest, ObjectDestroyMasterThenSlavesInSignalHandler) {
+    auto disconnecting = _new<Slave>();
+    slave = _new<Slave>();
+    EXPECT_CALL(*disconnecting, acceptMessageNoArgs());
+    EXPECT_CALL(*disconnecting, die());
+    EXPECT_CALL(*slave, die());
+    AObject::connect(master->message, slave, [&] {
+        master = nullptr;
+    });
+    AObject::connect(master->message, disconnecting, [&] {
+        disconnecting->acceptMessageNoArgs();
+        AObject::disconnect();
+    });
+    AObject::connect(master->message, slave, [&] {
+        slave = nullptr;
+    });
+    master->broadcastMessage("hello");
+    EXPECT_TRUE(master == nullptr);
+    EXPECT_TRUE(slave == nullptr);
+}
+
+/**
+ * A receiver bound to its thread releases the last reference to itself in its slot; it is destroyed after the slot
+ * returns.
+ */
+TEST_F(SignalSlotTest, ObjectReleaseSelfInSignalHandler) {
+    class Receiver: public AObject {
+    public:
+        Receiver(_<Receiver>& self, bool& destroyed): mSelf(self), mDestroyed(destroyed) {}
+        ~Receiver() override {
+            mDestroyed = true;
+        }
+
+        void accept() {
+            mSelf = nullptr;
+            EXPECT_FALSE(mDestroyed);
+            ++mCalled;
+        }
+
+    private:
+        _<Receiver>& mSelf;
+        bool& mDestroyed;
+        int mCalled = 0;
+    };
+
+    bool destroyed = false;
+    _<Receiver> receiver;
+    receiver = _new<Receiver>(receiver, destroyed);
+    receiver->setSlotsCallsOnlyOnMyThread(true);
+    AObject::connect(master->message, slot(receiver)::accept);
+    master->broadcastMessage("hello");
+    EXPECT_TRUE(receiver == nullptr);
+    EXPECT_TRUE(destroyed);
+
+    // the connection broken during the emission is cleaned by the next one.
+    master->broadcastMessage("hello");
+    EXPECT_TRUE(connections(master->message).empty());
+}
+
 
 TEST_F(SignalSlotTest, ObjectRemovalMultithread) {
     static constexpr auto SEND_COUNT = 10000;
@@ -447,3 +511,204 @@ TEST_F(SignalSlotTest, CopyTest) {
     s ^ s.copyTrapSignal(copyTrap);
     EXPECT_EQ(copyTrap.value, 1);
 }
+
+/**
+ * Connections to a shared signal and a shared receiver are created and broken concurrently while each thread emits its
+ * own signal; checks for crashes and leaked connections.
+ */
+TEST_F(SignalSlotTest, ConcurrentConnectDisconnect) {
+    static constexpr auto THREAD_COUNT = 4;
+    static constexpr auto ITERATIONS = 2000;
+
+    class Counter : public AObject {
+    public:
+        void accept() {
+            ++called;
+        }
+
+        std::atomic_int called = 0;
+    };
+
+    auto shared = _new<Counter>();
+    AFutureSet<> tasks;
+    for (int t = 0; t < THREAD_COUNT; ++t) {
+        tasks << async {
+            auto localMaster = _new<Master>();
+            auto receiver = _new<Counter>();
+            AUI_REPEAT(ITERATIONS) {
+                auto sharedSignalConnection = AObject::connect(master->message, slot(receiver)::accept);
+                auto sharedReceiverConnection = AObject::connect(localMaster->message, slot(shared)::accept);
+                localMaster->broadcastMessage("hello");
+                sharedSignalConnection->disconnect();
+                sharedReceiverConnection->disconnect();
+            }
+        };
+    }
+    tasks.waitForAll();
+
+    EXPECT_EQ(shared->called, THREAD_COUNT * ITERATIONS);
+    EXPECT_TRUE(connections(master->message).empty());
+    EXPECT_TRUE(connections(*shared).empty());
+}
+
+/**
+ * Destruction of a receiver breaks its connections to many senders at once, locking each sender's stripe once.
+ */
+TEST_F(SignalSlotTest, ReceiverOfManySendersTeardown) {
+    static constexpr auto SENDERS = 1000;
+
+    class Counter : public AObject {
+    public:
+        void accept() {
+            ++called;
+        }
+
+        int called = 0;
+    };
+
+    AVector<_<Master>> senders;
+    auto receiver = _new<Counter>();
+    auto other = _new<Counter>();
+    for (int i = 0; i < SENDERS; ++i) {
+        senders << _new<Master>();
+        // a few connections of the same signal, interleaved with another receiver's ones.
+        AObject::connect(senders.last()->message, slot(receiver)::accept);
+        AObject::connect(senders.last()->message, slot(other)::accept);
+        AObject::connect(senders.last()->message, slot(receiver)::accept);
+    }
+    EXPECT_EQ(connections(*receiver).size(), SENDERS * 2);
+    senders[0]->broadcastMessage("hello");
+    EXPECT_EQ(receiver->called, 2);
+
+    receiver = nullptr;
+    for (const auto& sender : senders) {
+        ASSERT_EQ(connections(sender->message).size(), 1);
+        sender->broadcastMessage("hello");
+    }
+    EXPECT_EQ(other->called, SENDERS + 1);
+    EXPECT_EQ(connections(*other).size(), SENDERS);
+
+    // senders destroyed before the receiver.
+    senders.clear();
+    EXPECT_TRUE(connections(*other).empty());
+}
+
+/**
+ * Connections are allocated from a pool; connections created on one thread can be released on another one.
+ */
+TEST_F(SignalSlotTest, ManyConnectionsTeardown) {
+    static constexpr auto COUNT = 5000;
+
+    class Counter : public AObject {
+    public:
+        void accept() {
+            ++called;
+        }
+
+        int called = 0;
+    };
+
+    AVector<_<Counter>> receivers;
+    for (int i = 0; i < COUNT; ++i) {
+        receivers << _new<Counter>();
+        AObject::connect(master->message, slot(receivers.last())::accept);
+    }
+
+    // slot whose state does not fit into the connection.
+    std::array<int, 64> bigState {};
+    bigState.back() = 1;
+    int bigStateCalled = 0;
+    auto bigStateReceiver = _new<Counter>();
+    AObject::connect(master->message, bigStateReceiver, [bigState, &bigStateCalled] {
+        bigStateCalled += bigState.back();
+    });
+
+    master->broadcastMessage("hello");
+    EXPECT_TRUE(std::all_of(receivers.begin(), receivers.end(), [](const _<Counter>& c) { return c->called == 1; }));
+    EXPECT_EQ(bigStateCalled, 1);
+
+    (asyncX [&] { receivers.clear(); }).wait(AFutureWait::JUST_WAIT);
+    EXPECT_EQ(connections(master->message).size(), 1);
+
+    bigStateReceiver = nullptr;
+    EXPECT_TRUE(connections(master->message).empty());
+}
+
+/**
+ * Slabs of the connection pool are returned to the system by ConnectionPool::trim once all of their connections are
+ * destroyed.
+ */
+TEST_F(SignalSlotTest, ConnectionPoolTrim) {
+    static constexpr auto COUNT = 5000;
+
+    class Counter : public AObject {
+    public:
+        void accept() {
+            ++called;
+        }
+
+        int called = 0;
+    };
+
+    AVector<_<Counter>> receivers;
+    for (int i = 0; i < COUNT; ++i) {
+        receivers << _new<Counter>();
+        AObject::connect(master->message, slot(receivers.last())::accept);
+    }
+    receivers.clear();
+    EXPECT_TRUE(connections(master->message).empty());
+
+    EXPECT_GT(aui::detail::signal::ConnectionPool::trim(), 0);
+
+    // the pool is still usable.
+    auto receiver = _new<Counter>();
+    AObject::connect(master->message, slot(receiver)::accept);
+    master->broadcastMessage("hello");
+    EXPECT_EQ(receiver->called, 1);
+}
+
+/**
+ * Cross-thread calls of a connection made with aui::coalesce are coalesced into a single slot call with the latest
+ * value.
+ */
+TEST_F(SignalSlotTest, Coalesce) {
+    class Worker : public AObject {
+    public:
+    signals:
+        emits<int> progress;
+    };
+
+    class ProgressView : public AObject {
+    public:
+        ProgressView() {
+            setSlotsCallsOnlyOnMyThread(true);
+        }
+
+        void setValue(int v) {
+            values << v;
+        }
+
+        AVector<int> values;
+    };
+
+    auto worker = _new<Worker>();
+    auto coalesced = _new<ProgressView>();
+    auto regular = _new<ProgressView>();
+    AObject::connect(worker->progress, slot(coalesced)::setValue, aui::coalesce);
+    AObject::connect(worker->progress, slot(regular)::setValue);
+
+    (async {
+        for (int i = 1; i <= 1000; ++i) {
+            *worker ^ worker->progress(i);
+        }
+    }).wait(AFutureWait::JUST_WAIT); // do not process messages while waiting
+    AThread::processMessages();
+
+    EXPECT_EQ(coalesced->values, AVector<int>{1000});
+    EXPECT_EQ(regular->values.size(), 1000);
+
+    // next emission is delivered again.
+    (async { *worker ^ worker->progress(1001); }).wait(AFutureWait::JUST_WAIT);
+    AThread::processMessages();
+    EXPECT_EQ(coalesced->values, (AVector<int>{1000, 1001}));
+}
@@ -15,6 +15,15 @@
 
 #include <gtest/gtest.h>
 #include <AUI/Common/AString.h>
+#include <AUI/Common/AByteBuffer.h>
+#include <AUI/Common/AMap.h>
+#include <AUI/Common/AStringBuilder.h>
+#include <AUI/Common/AStringVector.h>
+#include <AUI/Common/AUtf8String.h>
+#include <AUI/Common/detail/number.h>
+#include <AUI/Common/detail/utf.h>
+#include <AUI/Util/APrettyFormatter.h>
+#include <AUI/Util/ATokenizer.h>
 
 
 TEST(Strings, ToInt) {
@@ -48,6 +57,97 @@ TEST(Strings, ToFloat) {
     EXPECT_EQ("123abs"_as.toUInt(), std::nullopt);
     EXPECT_EQ("1a23"_as.toUInt(), std::nullopt);
     EXPECT_EQ("a123"_as.toUInt(), std::nullopt);
+
+    // 1 + 2^-24 + 2^-62: rounds to 1 + 2^-23 as float, but to the tie 1 + 2^-24 as double first.
+    EXPECT_EQ("1.0000000596046447755"_as.toFloat(), 1.00000011920928955078125f);
+    EXPECT_EQ("0.1"_as.toFloat(), 0.1f);
+}
+
+TEST(Strings, ToDouble) {
+    EXPECT_EQ("0.1"_as.toDouble(), 0.1);
+    EXPECT_EQ("-123.456"_as.toDouble(), -123.456);
+    EXPECT_EQ("1e3"_as.toDouble(), 1000.0);
+    EXPECT_EQ("2.5E-3"_as.toDouble(), 0.0025);
+    EXPECT_EQ(".5"_as.toDouble(), 0.5);
+    EXPECT_EQ("3.14159265358979323846264338327950288"_as.toDouble(), 3.14159265358979323846); // slow path
+    EXPECT_EQ("1.7976931348623157e308"_as.toDouble(), std::numeric_limits<double>::max());
+    EXPECT_EQ("1e400"_as.toDouble(), std::nullopt);
+    EXPECT_EQ("1e"_as.toDouble(), std::nullopt);
+    EXPECT_EQ("-"_as.toDouble(), std::nullopt);
+    EXPECT_EQ("1.2.3"_as.toDouble(), std::nullopt);
+    EXPECT_EQ(""_as.toDouble(), std::nullopt);
+}
+
+TEST(Strings, ToLongInt) {
+    EXPECT_EQ("9223372036854775807"_as.toLongInt(), std::numeric_limits<int64_t>::max());
+    EXPECT_EQ("-9223372036854775808"_as.toLongInt(), std::numeric_limits<int64_t>::min());
+    EXPECT_EQ("9223372036854775808"_as.toLongInt(), std::nullopt);
+    EXPECT_EQ("-2147483648"_as.toInt(), std::numeric_limits<int>::min());
+    EXPECT_EQ("2147483648"_as.toInt(), std::nullopt);
+    EXPECT_EQ("4294967295"_as.toUInt(), std::numeric_limits<unsigned>::max());
+    EXPECT_EQ("-1"_as.toUInt(), std::nullopt);
+}
+
+TEST(Strings, Number) {
+    EXPECT_EQ(AString::number(0), "0");
+    EXPECT_EQ(AString::number(-42), "-42");
+    EXPECT_EQ(AString::number(std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+    EXPECT_EQ(AString::number(std::numeric_limits<uint64_t>::max()), "18446744073709551615");
+    EXPECT_EQ(AString::number(true), "true");
+    EXPECT_EQ(AString::number(1.5), "1.5");
+    EXPECT_EQ(AString::number(-0.25f), "-0.25");
+    EXPECT_EQ(AString::number(100.0), "100");
+    EXPECT_EQ(AString::number(0.1 + 0.2), "0.3");
+    EXPECT_EQ(AString::number(1e-7), "0");
+    EXPECT_EQ(AString::number(1e20), "100000000000000000000");
+    EXPECT_EQ(AString::numberHex(255), "ff");
+    EXPECT_EQ(AString::numberHex(-1), "ffffffff");
+
+    char16_t buffer[aui::detail::number::MAX_INTEGER_LENGTH_ANY_BASE];
+    auto end = aui::detail::number::toChars(buffer, std::numeric_limits<int64_t>::min() + 1, 2);
+    EXPECT_EQ(AString(buffer, end), "-" + AString(63, u'1'));
+
+    for (std::uint64_t i = 1; i != 0 && i < std::numeric_limits<std::uint64_t>::max() / 3; i = i * 3 + 1) {
+        EXPECT_EQ(AString::number(i), std::to_string(i));
+    }
+
+    AString s = "x = ";
+    s.appendNumber(12) << u',';
+    s.appendNumber(0.5).appendNumber(false);
+    EXPECT_EQ(s, "x = 12,0.5false");
+}
+
+TEST(Strings, Builder) {
+    AStringBuilder builder;
+    builder << "row " << 12 << u':' << 3.5 << ' ' << AString("Привет") << u" " << std::string_view("мир ") << true;
+    builder.format(" {}x{}", 640, 480);
+    EXPECT_EQ(builder.str(), "row 12:3.5 Привет мир true 640x480");
+    EXPECT_EQ(std::move(builder).build(), "row 12:3.5 Привет мир true 640x480");
+
+    EXPECT_EQ(AStringBuilder::concat("unexpected character ", 'x', " at ", 1, ":", 15u), "unexpected character x at 1:15");
+    EXPECT_EQ(AStringBuilder::concat(), "");
+
+    // appends keep the reserved capacity.
+    AStringBuilder reserved(64);
+    reserved << "unexpected character " << 'x' << " at " << 1 << ":" << 15u;
+    EXPECT_EQ(reserved.str(), "unexpected character x at 1:15");
+    EXPECT_GE(reserved.str().capacity(), 64);
+
+    // the single allocation of concat is sized by the pieces and kept as is.
+    auto concatenated = AStringBuilder::concat("unexpected character ", 'x', " at ", 1, ":", 15u);
+    EXPECT_GT(concatenated.capacity(), concatenated.length() * 3 / 2);
+}
+
+TEST(Strings, Join) {
+    EXPECT_EQ((AStringVector{"a", "bc", "d"}.join(',')), "a,bc,d");
+    EXPECT_EQ((AStringVector{"a", "bc", "d"}.join(", ")), "a, bc, d");
+    EXPECT_EQ(AStringVector{}.join(", "), "");
+}
+
+TEST(Strings, PrettySizeInBytes) {
+    EXPECT_EQ(APrettyFormatter::sizeInBytes(512), "512 b");
+    EXPECT_EQ(APrettyFormatter::sizeInBytes(1536 * 1024), "1536 Kb");
+    EXPECT_EQ(APrettyFormatter::sizeInBytes(3584 * 1024), "3.5 Mb");
 }
 
 TEST(Strings, Uppercase1) {
@@ -55,13 +155,51 @@ TEST(Strings, Uppercase1) {
 }
 
 TEST(Strings, Uppercase2) {
-    EXPECT_EQ("àáâäǎæãāăą ŵëþűųǐíïıįğ çżð"_as.uppercase(), "ÀÁÂÄǍÆÃĀĂĄ ŴËÞŰŲǏÍÏİĮĞ ÇŻÐ");
+    EXPECT_EQ("àáâäǎæãāăą ŵëþűųǐíïıįğ çżð"_as.uppercase(), "ÀÁÂÄǍÆÃĀĂĄ ŴËÞŰŲǏÍÏIĮĞ ÇŻÐ");
 }
 
 TEST(Strings, Downcase1) {
     EXPECT_EQ("Å"_as.lowercase(), "å");
 }
 
+TEST(Strings, CaseMapping) {
+    EXPECT_EQ("Hello, World! 123"_as.uppercase(), "HELLO, WORLD! 123");
+    EXPECT_EQ("Hello, World! 123"_as.lowercase(), "hello, world! 123");
+    EXPECT_EQ("Съешь же ещё этих мягких французских булок"_as.uppercase(), "СЪЕШЬ ЖЕ ЕЩЁ ЭТИХ МЯГКИХ ФРАНЦУЗСКИХ БУЛОК");
+    EXPECT_EQ("ΑΒΓΔ Ωμέγα"_as.lowercase(), "αβγδ ωμέγα");
+    EXPECT_EQ("ǅ ǆ ß ſ"_as.uppercase(), "Ǆ Ǆ ß S");
+    EXPECT_EQ("𐐨𐐩 Ⓐ ａｂｃ"_as.uppercase(), "𐐀𐐁 Ⓐ ＡＢＣ"); // supplementary and fullwidth
+
+    // crosses block boundaries of the vectorized ASCII path at every offset.
+    for (std::size_t offset = 0; offset < 40; ++offset) {
+        AString s = AString(offset, u'x') + "Ünïcödé and ASCII, 𐐨" + AString(offset, u'Y');
+        EXPECT_EQ(s.uppercase(), AString(offset, u'X') + "ÜNÏCÖDÉ AND ASCII, 𐐀" + AString(offset, u'Y'));
+        EXPECT_EQ(s.lowercase(), AString(offset, u'x') + "ünïcödé and ascii, 𐐨" + AString(offset, u'y'));
+    }
+}
+
+TEST(Strings, IgnoreCase) {
+    EXPECT_TRUE("Hello"_as.equalsIgnoreCase("hELLO"));
+    EXPECT_TRUE("ПРИВЕТ"_as.equalsIgnoreCase("привет"));
+    EXPECT_TRUE("ΣΊΣΥΦΟΣ"_as.equalsIgnoreCase("σίσυφος"));
+    EXPECT_TRUE("𐐀"_as.equalsIgnoreCase("𐐨"));
+    EXPECT_FALSE("Hello"_as.equalsIgnoreCase("Hell"));
+    EXPECT_FALSE("Hello"_as.equalsIgnoreCase("Help!"));
+
+    EXPECT_EQ("abc"_as.compareIgnoreCase("ABC"), 0);
+    EXPECT_LT("abc"_as.compareIgnoreCase("ABD"), 0);
+    EXPECT_GT("abd"_as.compareIgnoreCase("ABC"), 0);
+    EXPECT_LT("ab"_as.compareIgnoreCase("ABC"), 0);
+    EXPECT_GT("abc"_as.compareIgnoreCase("AB"), 0);
+
+    EXPECT_EQ("Straße"_as.hashIgnoreCase(), "STRAẞE"_as.hashIgnoreCase());
+    AUnorderedMap<AString, int, AString::HashIgnoreCase, AString::EqualIgnoreCase> map;
+    map["Key"] = 1;
+    map["KEY"] = 2;
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(map["key"], 2);
+}
+
 TEST(Strings, ReplaceAll1) {
     EXPECT_EQ("abcdef"_as.replaceAll("ab", "12"), "12cdef");
 }
@@ -94,7 +232,115 @@ TEST(Strings, ReplaceAll8) {
     EXPECT_EQ("abcdef"_as.replaceAll("bcd", ""), "aef");
 }
 
+TEST(Strings, ReplaceAllMultiple) {
+    EXPECT_EQ("a-b-c-d"_as.replaceAll("-", "--"), "a--b--c--d");
+    EXPECT_EQ("aaaa"_as.replaceAll("aa", "b"), "bb");
+    EXPECT_EQ("abab"_as.replaceAll("ab", "ba"), "baba");
+    EXPECT_EQ("abcdef"_as.replaceAll("", "x"), "abcdef");
+    EXPECT_EQ("abcdef"_as.replacedAll("xyz", "1"), "abcdef");
+}
+
+TEST(Strings, Find) {
+    // crosses block boundaries of the vectorized search at every offset.
+    for (std::size_t offset = 0; offset < 40; ++offset) {
+        AString s = AString(offset, u'x') + "Привет, world!" + AString(offset, u'y');
+        EXPECT_EQ(s.find(u'П'), offset);
+        EXPECT_EQ(s.find(u'!'), offset + 13);
+        EXPECT_EQ(s.find(u'!', offset + 14), AString::NPOS);
+        EXPECT_EQ(s.find(u"world"), offset + 8);
+        EXPECT_EQ(s.find(u"wor1d"), AString::NPOS);
+        EXPECT_EQ(s.find(u"xП"), offset == 0 ? AString::NPOS : offset - 1);
+        EXPECT_EQ(s.find(u"!y", 0), offset == 0 ? AString::NPOS : offset + 13);
+        EXPECT_EQ(s.find(u"", offset), offset);
+        EXPECT_EQ(std::u16string_view(s.data(), s.size()).find(u"!y"), s.find(u"!y"));
+        EXPECT_TRUE(s.contains(u"ет, w"));
+        EXPECT_FALSE(s.contains(u"ет,w"));
+    }
+    EXPECT_EQ("aaab"_as.find("aab"), 1u);
+    EXPECT_EQ("ab"_as.find("abc"), AString::NPOS);
+    EXPECT_EQ("ab"_as.find("b", 3), AString::NPOS);
+}
+
+TEST(Strings, Split) {
+    EXPECT_EQ("a,bc,,d"_as.split(','), (AStringVector{"a", "bc", "", "d"}));
+    EXPECT_EQ(","_as.split(','), (AStringVector{"", ""}));
+    EXPECT_TRUE(""_as.split(',').empty());
+
+    AString s = "a,bc,,d";
+    auto views = s.splitView(',');
+    ASSERT_EQ(views.size(), 4u);
+    EXPECT_EQ(views[1], u"bc");
+    EXPECT_EQ(views[1].data(), s.data() + 2);
+    EXPECT_TRUE(views[2].empty());
+    EXPECT_EQ(views[3], u"d");
+}
+
 TEST(Strings, Utf8) {
     EXPECT_EQ("🤡"_as, "🤡");
     EXPECT_EQ("🤡"_as.toStdString(), "🤡");
-}
\ No newline at end of file
+}
+
+TEST(Strings, Utf8Long) {
+    // crosses block boundaries of the vectorized transcoder at every offset.
+    std::string utf8 = "Hello, world! Привет, мир! 你好，世界！🤡🤡 Hello again, plain ascii text.";
+    for (std::size_t offset = 0; offset < utf8.size(); ++offset) {
+        std::string prefixed = std::string(offset, 'x') + utf8 + std::string(offset, 'y');
+        AString s = prefixed;
+        EXPECT_EQ(s.length(), offset * 2 + AString(utf8).length());
+        EXPECT_EQ(s.toStdString(), prefixed);
+        auto buffer = s.toUtf8();
+        EXPECT_EQ(std::string(buffer.data(), buffer.size()), prefixed);
+    }
+    EXPECT_EQ(AString("你好，世界！").length(), 6);
+    EXPECT_EQ(AString("🤡").length(), 2);
+
+    // 3 bytes per code unit; the decoded string does not keep the capacity sized for the input bytes.
+    std::string cjk;
+    for (int i = 0; i < 100; ++i) {
+        cjk += "你好，世界！";
+    }
+    AString decoded = cjk;
+    EXPECT_EQ(decoded.length(), 600);
+    EXPECT_LT(decoded.capacity(), cjk.size() / 2);
+}
+
+TEST(Strings, Utf8Malformed) {
+    // malformed sequences are skipped.
+    EXPECT_EQ(AString("a\x80" "b"), "ab");                      // stray continuation byte
+    EXPECT_EQ(AString("a\xd0" "b"), "ab");                      // interrupted sequence
+    EXPECT_EQ(AString("0123456789abcdef\xe4\xbd"), "0123456789abcdef"); // truncated sequence
+    EXPECT_EQ(AString("a\xf8\x80\x80\x80\x80" "b"), "ab");      // invalid lead byte
+    EXPECT_EQ(AString("a\xf7\xbf\xbf\xbf" "b"), "ab");          // above U+10FFFF
+
+    // decoding stops at the null terminator.
+    EXPECT_EQ(AString(std::string_view("ab\0cd", 5)), "ab");
+
+    // unpaired surrogates survive the round trip.
+    AString loneSurrogate = u"a\xd800" "b";
+    EXPECT_EQ(AString(loneSurrogate.toStdString()), loneSurrogate);
+}
+
+TEST(Strings, Utf8String) {
+    AUtf8String utf8 = "Привет, мир!";
+    EXPECT_EQ(utf8.size(), 21);
+    EXPECT_EQ(utf8.toAString(), "Привет, мир!"_as);
+    EXPECT_EQ(AUtf8String("Привет, мир!"_as), utf8);
+    EXPECT_EQ(fmt::format("{}", utf8), "Привет, мир!");
+
+    // AUtf8String is accepted wherever AString is.
+    AString utf16 = utf8;
+    EXPECT_EQ(utf16.length(), 12);
+
+    // and is tokenized without transcoding.
+    ATokenizer t(utf8);
+    EXPECT_EQ(t.readStringUntilUnescaped(','), "Привет");
+}
+
+TEST(Strings, Utf8CString) {
+    EXPECT_STREQ(aui::detail::utf::CString(u"Привет").c_str(), "Привет");
+
+    // longer strings are encoded to the heap.
+    std::string longString(aui::detail::utf::CString::STACK_SIZE * 2, 'a');
+    AString longAString = longString;
+    EXPECT_EQ(aui::detail::utf::CString({ longAString.data(), longAString.size() }).c_str(), longString);
+}
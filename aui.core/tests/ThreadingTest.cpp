@@ -21,11 +21,13 @@
 #include <chrono>
 #include <random>
 #include <ctime>
+#include <numeric>
 #include "AUI/Common/ATimer.h"
 #include "AUI/Thread/AThread.h"
 #include "AUI/Traits/parallel.h"
 #include "AUI/Thread/AAsyncHolder.h"
 #include "AUI/Util/ARaiiHelper.h"
+#include "AUI/Common/ASet.h"
 
 using namespace std::chrono_literals;
 
@@ -432,3 +434,372 @@ TEST(Threading, AsyncHolder) {
     }
     holderDestroyed = true;
 }
+
+TEST(Threading, WorkStealing) {
+    // tasks spawned from a worker go to its local deque; other workers should steal them.
+    AThreadPool localThreadPool(4);
+    std::atomic_int counter = 0;
+    AMutex sync;
+    ASet<AThread::id> threads;
+    localThreadPool.run([&] {
+        for (int i = 0; i < 1000; ++i) {
+            localThreadPool.run([&] {
+                {
+                    std::unique_lock lock(sync);
+                    threads << std::this_thread::get_id();
+                }
+                AThread::sleep(1ms);
+                counter += 1;
+            });
+        }
+    });
+    for (int i = 0; i < 500 && counter < 1000; ++i) {
+        AThread::sleep(10ms);
+    }
+    EXPECT_EQ(counter, 1000);
+    EXPECT_GT(threads.size(), 1);
+    EXPECT_EQ(localThreadPool.getPendingTaskCount(), 0);
+}
+
+TEST(Threading, TryLater) {
+    // the only worker runs a task queued after the first attempt once that attempt is deferred.
+    AThreadPool localThreadPool(1);
+    std::atomic_int attempts = 0;
+    AFuture<> firstAttempt, secondAttempt;
+    localThreadPool.run([&] {
+        localThreadPool.run([&] {
+            if (attempts++ == 0) {
+                firstAttempt.supplyValue();
+                throw AThreadPool::TryLaterException{};
+            }
+            secondAttempt.supplyValue();
+        });
+    });
+    firstAttempt.get(AFutureWait::JUST_WAIT);
+    (localThreadPool * [] {}).get(AFutureWait::JUST_WAIT);
+    EXPECT_EQ(attempts, 1);
+    localThreadPool.runLaterTasks();
+    secondAttempt.get(AFutureWait::JUST_WAIT);
+    EXPECT_EQ(attempts, 2);
+}
+
+TEST(Threading, MoveOnlyTask) {
+    // tasks are not required to be copyable
+    AThreadPool localThreadPool(1);
+    auto value = std::make_unique<int>(228);
+    AFuture<int> result;
+    localThreadPool.run([value = std::move(value), result] {
+        result.supplyValue(*value);
+    });
+    EXPECT_EQ(*result, 228);
+}
+
+TEST(Threading, LockFreeMessageQueue) {
+    static constexpr auto PRODUCERS = 4;
+    static constexpr auto MESSAGES_PER_PRODUCER = 10000;
+    ALockFreeMessageQueue<> queue;
+    std::array<int, PRODUCERS> lastReceived;
+    lastReceived.fill(-1);
+    std::atomic_int processed = 0;
+
+    AVector<_<AThread>> producers;
+    for (int producer = 0; producer < PRODUCERS; ++producer) {
+        producers << _new<AThread>([&, producer] {
+            for (int i = 0; i < MESSAGES_PER_PRODUCER; ++i) {
+                queue.enqueue([&, producer, i] {
+                    // messages of the same producer should be received in order
+                    EXPECT_EQ(lastReceived[producer] + 1, i);
+                    lastReceived[producer] = i;
+                    processed += 1;
+                });
+            }
+        });
+    }
+    for (const auto& p : producers) {
+        p->start();
+    }
+    while (processed < PRODUCERS * MESSAGES_PER_PRODUCER) {
+        queue.processMessages();
+    }
+    for (const auto& p : producers) {
+        p->join();
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.size(), 0);
+}
+
+TEST(Threading, ParallelForSkewed) {
+    AThreadPool localThreadPool(4);
+    AVector<std::atomic_int> visits(1000);
+    std::atomic_size_t calls = 0;
+    aui::parallel_for(std::size_t(0), visits.size(), [&](std::size_t begin, std::size_t end) {
+        calls += 1;
+        for (auto i = begin; i != end; ++i) {
+            if (i < 10) {
+                // skewed workload: first items are much heavier
+                AThread::sleep(10ms);
+            }
+            visits[i] += 1;
+        }
+    }, 1, localThreadPool);
+    for (const auto& v : visits) {
+        EXPECT_EQ(v, 1);
+    }
+    EXPECT_GT(calls, 5);
+}
+
+TEST(Threading, ParallelForException) {
+    AThreadPool localThreadPool(2);
+    auto items = AVector<int>::generate(1000, [](std::size_t i) { return int(i); });
+    EXPECT_THROW(aui::parallel_for(items.begin(), items.end(), [](auto begin, auto end) {
+        for (auto it = begin; it != end; ++it) {
+            if (*it == 500) {
+                throw AException("test");
+            }
+        }
+    }, 1, localThreadPool), AException);
+}
+
+TEST(Threading, ParallelAlgorithms) {
+    AThreadPool localThreadPool(3);
+    // the sum is about 5e9; the scan accumulates in the value type, so it must not be int.
+    auto items =
+        AVector<std::int64_t>::generate(100'000, [](std::size_t i) { return std::int64_t(i * 7919 % 100'003); });
+
+    EXPECT_EQ(aui::parallel_reduce(items.begin(), items.end(), std::int64_t(0), std::plus<>{}, 0, localThreadPool),
+              std::accumulate(items.begin(), items.end(), std::int64_t(0)));
+
+    AVector<std::int64_t> doubled(items.size());
+    aui::parallel_transform(
+        items.begin(), items.end(), doubled.begin(), [](std::int64_t i) { return i * 2; }, 0, localThreadPool);
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        ASSERT_EQ(doubled[i], items[i] * 2);
+    }
+
+    AVector<std::int64_t> scan(items.size()), expectedScan(items.size());
+    aui::parallel_inclusive_scan(items.begin(), items.end(), scan.begin(), std::plus<>{}, 0, localThreadPool);
+    std::inclusive_scan(items.begin(), items.end(), expectedScan.begin(), std::plus<std::int64_t>{});
+    EXPECT_EQ(scan, expectedScan);
+
+    auto sorted = items;
+    aui::parallel_sort(sorted.begin(), sorted.end(), std::less<>{}, localThreadPool);
+    auto expectedSorted = items;
+    std::sort(expectedSorted.begin(), expectedSorted.end());
+    EXPECT_EQ(sorted, expectedSorted);
+}
+
+TEST(Threading, FutureThen) {
+    AThreadPool localThreadPool(1);
+    AFuture<int> input;
+    auto doubled = input.then(localThreadPool, [](int v) { return v * 2; });
+    auto text = doubled.then([](int v) { return AString::number(v); });
+
+    // the only worker is not parked by the continuation waiting for its input.
+    EXPECT_EQ(*(localThreadPool * [] { return 5; }), 5);
+    EXPECT_FALSE(doubled.hasResult());
+
+    input.supplyValue(21);
+    EXPECT_EQ(*doubled, 42);
+    EXPECT_EQ(*text, "42");
+
+    // already completed input; continuation returning a future is flattened.
+    auto flattened = AFuture<int>(1).then(localThreadPool, [&](int v) {
+        return localThreadPool * [v] { return v + 1; };
+    });
+    EXPECT_EQ(*flattened, 2);
+
+    // exceptions bypass continuations.
+    bool called = false;
+    AFuture<int> failing;
+    auto chained = failing.then(localThreadPool, [&](int v) { called = true; return v; })
+                          .then([](int v) { return v; });
+    failing.supplyException(std::make_exception_ptr(AException("test")));
+    EXPECT_THROW(*chained, AException);
+    EXPECT_FALSE(called);
+
+    // move-only continuation is stored until the input completes.
+    AFuture<int> pending;
+    auto moveOnly = pending.then(localThreadPool, [factor = std::make_unique<int>(3)](int v) { return v * *factor; });
+    pending.supplyValue(4);
+    EXPECT_EQ(*moveOnly, 12);
+
+    // continuation on a specific thread.
+    auto thread = _new<AThread>([] {
+        for (;;) {
+            AThread::processMessages();
+            AThread::sleep(std::chrono::milliseconds(1));
+        }
+    });
+    thread->start();
+    AFuture<> trigger;
+    auto onThread = trigger.then(_<AAbstractThread>(thread), [] { return AThread::current(); });
+    trigger.supplyValue();
+    EXPECT_EQ(*onThread, thread);
+    thread->interrupt();
+    thread->join();
+}
+
+TEST(Threading, FutureWhenAllWhenAny) {
+    AThreadPool localThreadPool(2);
+
+    // diamond: a -> (b, c) -> d
+    AFuture<int> a;
+    auto b = a.then(localThreadPool, [](int v) { return v + 1; });
+    auto c = a.then(localThreadPool, [](int v) { return v * 10; });
+    auto d = aui::when_all(b, c).then(localThreadPool, [](const std::tuple<int, int>& v) {
+        return std::get<0>(v) + std::get<1>(v);
+    });
+    a.supplyValue(3);
+    EXPECT_EQ(*d, 34);
+
+    AVector<AFuture<int>> inputs;
+    for (int i = 0; i < 10; ++i) {
+        inputs << localThreadPool * [i] { return i * i; };
+    }
+    EXPECT_EQ(*aui::when_all(inputs), AVector<int>({ 0, 1, 4, 9, 16, 25, 36, 49, 64, 81 }));
+    EXPECT_TRUE((*aui::when_all(AVector<AFuture<int>>{})).empty());
+
+    AFuture<int> never, failed, winner;
+    auto any = aui::when_any(AVector<AFuture<int>>{ never, failed, winner });
+    failed.supplyException(std::make_exception_ptr(AException("test")));
+    EXPECT_FALSE(any.hasResult());
+    winner.supplyValue(7);
+    EXPECT_EQ(*any, 2);
+
+    AFuture<> fail1, fail2;
+    auto allFailed = aui::when_any(AVector<AFuture<>>{ fail1, fail2 });
+    fail1.supplyException(std::make_exception_ptr(AException("1")));
+    fail2.supplyException(std::make_exception_ptr(AException("2")));
+    EXPECT_THROW(*allFailed, AException);
+}
+
+TEST(Threading, Telemetry) {
+    using Telemetry = AThreadPool::Telemetry;
+    EXPECT_EQ(Telemetry::bucketOf(std::chrono::nanoseconds(500)), 0);
+    EXPECT_EQ(Telemetry::bucketOf(std::chrono::microseconds(1)), 1);
+    EXPECT_EQ(Telemetry::bucketOf(std::chrono::microseconds(3)), 2);
+    EXPECT_EQ(Telemetry::bucketOf(std::chrono::hours(1)), Telemetry::HISTOGRAM_BUCKETS - 1);
+
+    AThreadPool localThreadPool(2);
+    auto before = localThreadPool.telemetry();
+    EXPECT_EQ(before.executed(), 0);
+    EXPECT_EQ(before.workers, 2);
+
+    for (int i = 0; i < 100; ++i) {
+        localThreadPool.run([] {}, AThreadPool::PRIORITY_HIGHEST);
+    }
+    AFuture<> started, release;
+    localThreadPool.run([&] {
+        started.supplyValue();
+        release.get(AFutureWait::JUST_WAIT);
+    });
+    started.get(AFutureWait::JUST_WAIT);
+    // the task has been running for at least as long as we sleep, however loaded the machine is.
+    AThread::sleep(std::chrono::milliseconds(40));
+    auto during = localThreadPool.telemetry();
+    EXPECT_GE(during.longestRunning, std::chrono::milliseconds(40));
+    release.supplyValue();
+    // counters are updated after the task returns.
+    while (localThreadPool.telemetry().executed() < 101) {
+        AThread::sleep(std::chrono::milliseconds(1));
+    }
+
+    auto after = localThreadPool.telemetry();
+    EXPECT_EQ(after.priorities[AThreadPool::PRIORITY_HIGHEST].executed(), 100);
+    EXPECT_EQ(after.priorities[AThreadPool::PRIORITY_MEDIUM].executed(), 1);
+    EXPECT_EQ(after.executed(), 101);
+    EXPECT_GE(after.longestExecution, std::chrono::milliseconds(40));
+    EXPECT_EQ(after.longestRunning, std::chrono::nanoseconds(0));
+    EXPECT_GT(after.tasksPerSecond(before), 0);
+    EXPECT_GE(Telemetry::percentile(after.priorities[AThreadPool::PRIORITY_MEDIUM].executionTime, 0.95),
+              std::chrono::milliseconds(40));
+}
+
+TEST(Threading, ElasticThreadPool) {
+    AThreadPool localThreadPool(2);
+    localThreadPool.setElastic(4, std::chrono::milliseconds(50));
+    EXPECT_TRUE(localThreadPool.isElastic());
+
+    // both workers wait for a value supplied by a task queued after them; a fixed pool would deadlock here.
+    AFuture<int> value;
+    auto waiter1 = localThreadPool * [&] { return value.get(AFutureWait::JUST_WAIT) + 1; };
+    auto waiter2 = localThreadPool * [&] { return value.get(AFutureWait::JUST_WAIT) + 2; };
+    // both workers are blocked. Workers that have not started yet are not compensated by temporary ones, so even if the
+    // waiters are queued before the workers start, it's the permanent workers that pick them.
+    while (localThreadPool.getIdleWorkerCount() > 0 || localThreadPool.getPendingTaskCount() > 0) {
+        AThread::sleep(std::chrono::milliseconds(1));
+    }
+    localThreadPool.run([&] { value.supplyValue(10); });
+
+    EXPECT_EQ(*waiter1, 11);
+    EXPECT_EQ(*waiter2, 12);
+    EXPECT_GE(localThreadPool.getTotalWorkerCount(), 3);
+    EXPECT_LE(localThreadPool.getTotalWorkerCount(), 4);
+
+    // temporary workers retire after idle timeout.
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (localThreadPool.getTotalWorkerCount() > 2 && std::chrono::steady_clock::now() < deadline) {
+        AThread::sleep(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(localThreadPool.getTotalWorkerCount(), 2);
+    EXPECT_EQ(*(localThreadPool * [] { return 1; }), 1);
+}
+
+#if AUI_PLATFORM_LINUX
+#include <unistd.h>
+#include "AUI/Platform/linux/ALinuxEventLoop.h"
+
+TEST(Threading, LinuxEventLoop) {
+    auto loop = _new<ALinuxEventLoop>();
+    auto thread = _new<AThread>([loop] {
+        IEventLoop::Handle handle(loop.get());
+        loop->loop();
+    });
+    thread->start();
+
+    // thread messages
+    AFuture<_<AAbstractThread>> messageThread;
+    thread->enqueue([&] { messageThread.supplyValue(AThread::current()); });
+    EXPECT_EQ(*messageThread, thread);
+
+    // fd readiness
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    AFuture<char> received;
+    loop->registerCallback(fds[0], UnixPollEvent::IN, [&](ABitField<UnixPollEvent> flags) {
+        EXPECT_TRUE(bool(flags & UnixPollEvent::IN));
+        char c;
+        ASSERT_EQ(read(fds[0], &c, 1), 1);
+        received.supplyValue(c);
+    });
+    ASSERT_EQ(write(fds[1], "x", 1), 1);
+    EXPECT_EQ(*received, 'x');
+    loop->unregisterCallback(fds[0]);
+    close(fds[0]);
+    close(fds[1]);
+
+    // timers
+    std::atomic_int oneShotCount = 0;
+    std::atomic_int repeatingCount = 0;
+    AFuture<> oneShotFired;
+    loop->enqueue(std::chrono::milliseconds(10), [&] {
+        ++oneShotCount;
+        oneShotFired.supplyValue();
+    });
+    auto repeating = loop->timer(std::chrono::milliseconds(5), [&] { ++repeatingCount; });
+    oneShotFired.wait();
+    while (repeatingCount < 3) {
+        AThread::sleep(std::chrono::milliseconds(1));
+    }
+    loop->removeTimer(repeating);
+    // let the loop drain an event that could be fetched before removal.
+    AThread::sleep(std::chrono::milliseconds(20));
+    int countAfterRemoval = repeatingCount;
+    AThread::sleep(std::chrono::milliseconds(30));
+    EXPECT_EQ(repeatingCount, countAfterRemoval);
+    EXPECT_EQ(oneShotCount, 1);
+
+    loop->stop();
+    thread->join();
+}
+#endif
@@ -20,6 +20,7 @@
 
 #include "AUI/Common/AString.h"
 #include "AUI/Logging/ALogger.h"
+#include "AUI/Thread/ABlockingSection.h"
 #include "ACurlMulti.h"
 
 #undef min
@@ -401,7 +402,10 @@ ACurl::Response ACurl::Builder::runBlocking() {
         return buf.size();
     };
     ACurl r(*this);
-    r.run();
+    {
+        ABlockingSection blocking;
+        r.run();
+    }
     return makeResponse(r, std::move(out));
 }
 
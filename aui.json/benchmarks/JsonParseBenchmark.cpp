@@ -1,6 +1,7 @@
 #include <benchmark/benchmark.h>
 #include <AUI/Curl/ACurl.h>
 #include <AUI/Platform/AProcess.h>
+#include "AUI/Common/AArena.h"
 #include "AUI/Json/AJson.h"
 #include "AUI/Thread/AThread.h"
 
@@ -20,4 +21,25 @@ static void JsonParse(benchmark::State& state) {
     state.counters["ProcessMemory"] = memUsage;
 }
 
-BENCHMARK(JsonParse)->Iterations(10);
\ No newline at end of file
+BENCHMARK(JsonParse)->Iterations(10);
+
+static void JsonParseArena(benchmark::State& state) {
+    auto rawJson = ACurl::Builder("https://raw.githubusercontent.com/json-iterator/test-data/master/large-file.json").runBlocking().body;
+
+    auto beforeTest = AProcess::self()->processMemory();
+    size_t memUsage = 0;
+    AArena arena;
+    for (auto _ : state) {
+        {
+            auto json = AJson::fromBuffer(rawJson, &arena);
+            benchmark::DoNotOptimize(json);
+            auto memDiff = AProcess::self()->processMemory() - beforeTest;
+            memUsage = std::max(memDiff, memUsage);
+        }
+        arena.reset();
+    }
+
+    state.counters["ProcessMemory"] = memUsage;
+}
+
+BENCHMARK(JsonParseArena)->Iterations(10);
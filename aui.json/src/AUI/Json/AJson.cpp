@@ -21,11 +21,33 @@ AString AJson::toString(const AJson& json) {
     return AString::fromUtf8(buffer);
 }
 
+AUtf8String AJson::toUtf8String(const AJson& json) {
+    struct Utf8StringOutputStream final: IOutputStream {
+        AUtf8String& dst;
+        explicit Utf8StringOutputStream(AUtf8String& dst): dst(dst) {}
+        void write(const char* src, size_t size) override {
+            dst.append(src, size);
+        }
+    };
+    AUtf8String result;
+    Utf8StringOutputStream os(result);
+    aui::serialize(os, json);
+    return result;
+}
+
 AJson AJson::fromString(const AString& json) {
     AStringStream sis(json);
     return aui::deserialize<AJson>(sis);
 }
 
+AJson AJson::fromString(const std::string& json) {
+    return aui::deserialize<AJson>(AByteBufferInputStream(AByteBufferView(json)));
+}
+
+AJson AJson::fromString(const char* json) {
+    return aui::deserialize<AJson>(AByteBufferInputStream(AByteBufferView(std::string_view(json))));
+}
+
 AJson AJson::fromBuffer(AByteBufferView buffer) {
     try {
         return aui::deserialize<AJson>(AByteBufferInputStream(buffer));
@@ -34,6 +56,17 @@ AJson AJson::fromBuffer(AByteBufferView buffer) {
     }
 }
 
+AJson AJson::fromBuffer(AByteBufferView buffer, std::pmr::memory_resource* resource) {
+    try {
+        AByteBufferInputStream is(buffer);
+        AJson result;
+        ASerializable<AJson>::read(is, result, resource);
+        return result;
+    } catch (...) {
+        throw AJsonException("While parsing:\n" + AString::fromUtf8(buffer), std::current_exception());
+    }
+}
+
 AJson AJson::mergedWith(const AJson &other) {
     auto& thisObject = as<Object>();
     auto& otherObject = other.as<Object>();
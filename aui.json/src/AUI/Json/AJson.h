@@ -19,6 +19,8 @@
 #include "AJson.h"
 #include "AUI/Common/AByteBufferView.h"
 
+#include <AUI/Common/AArena.h>
+#include <AUI/Common/AUtf8String.h>
 #include <AUI/Common/AUuid.h>
 #include <AUI/Common/AMap.h>
 #include <AUI/Json/AJson.h>
@@ -33,9 +35,13 @@
 
 class AJson;
 namespace aui::impl {
-    struct JsonObject: AVector<std::pair<AString, AJson>> {
+    /*
+     * Arrays and objects take a memory resource, so a whole document can be parsed into an AArena. Default
+     * constructed ones allocate from the default resource as usual.
+     */
+    struct JsonObject: aui::pmr::AVector<std::pair<AString, AJson>> {
     public:
-        using AVector<std::pair<AString, AJson>>::AVector;
+        using aui::pmr::AVector<std::pair<AString, AJson>>::AVector;
 
         /**
          * @brief If container contains key, returns pointer to the element. nullptr otherwise.
@@ -73,7 +79,7 @@ namespace aui::impl {
             return const_cast<JsonObject&>(*this).at(key);
         }
     };
-    using JsonArray = AVector<AJson>;
+    using JsonArray = aui::pmr::AVector<AJson>;
     using JsonVariant = std::variant<std::nullopt_t, std::nullptr_t, int, int64_t, double, bool, AString, aui::impl::JsonArray, aui::impl::JsonObject>;
 }
 
@@ -314,11 +320,47 @@ public:
     API_AUI_JSON AJson mergedWith(const AJson& other);
 
     [[nodiscard]] static API_AUI_JSON AString toString(const AJson& json);
+
+    /**
+     * @brief Serializes json to UTF-8 string without going through AString.
+     */
+    [[nodiscard]] static API_AUI_JSON AUtf8String toUtf8String(const AJson& json);
+
     [[nodiscard]] static API_AUI_JSON AJson fromString(const AString& json);
+
+    /**
+     * @brief Parses UTF-8 json as is, without transcoding.
+     * @details
+     * Accepts AUtf8String and std::string.
+     */
+    [[nodiscard]] static API_AUI_JSON AJson fromString(const std::string& json);
+
+    /**
+     * @brief Parses UTF-8 json as is, without transcoding.
+     */
+    [[nodiscard]] static API_AUI_JSON AJson fromString(const char* json);
     [[nodiscard]] static AJson fromStream(aui::no_escape<IInputStream> stream) {
         return aui::deserialize<AJson>(stream);
     }
     [[nodiscard]] static API_AUI_JSON AJson fromBuffer(AByteBufferView buffer);
+
+    /**
+     * @brief Parses UTF-8 json allocating arrays and objects from the specified memory resource.
+     * @details
+     * Pass an AArena to release the whole document at once:
+     * @code{cpp}
+     * AArena arena;
+     * {
+     *     auto json = AJson::fromBuffer(buffer, &arena);
+     *     ...
+     * }
+     * arena.reset();
+     * @endcode
+     * The document must be destroyed before the arena is reset; copy the values that must outlive it, since copies
+     * allocate from the default resource. Strings longer than AString's inline capacity are still allocated from the
+     * heap.
+     */
+    [[nodiscard]] static API_AUI_JSON AJson fromBuffer(AByteBufferView buffer, std::pmr::memory_resource* resource);
 };
 
 
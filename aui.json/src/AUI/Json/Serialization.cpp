@@ -9,34 +9,36 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include <memory>
 #include <AUI/IO/AByteBufferInputStream.h>
 #include "AJson.h"
 #include "AUI/Util/ATokenizer.h"
 #include "AJson.h"
 #include "Serialization.h"
 #include "AUI/Traits/callables.h"
+#include "AUI/Common/AStringBuilder.h"
+#include "AUI/Common/detail/number.h"
+#include "AUI/Common/detail/utf.h"
 
 
-static AJson read(ATokenizer& t) {
+static AJson read(ATokenizer& t, std::pmr::memory_resource* resource) {
     try {
         auto unexpectedCharacter = [&]() {
-            throw AJsonParseException(
-                    AString("unexpected character ") + t.getLastCharacter() + " at " + AString::number(t.getRow()) + ":"
-                    + AString::number(t.getColumn()));
+            throw AJsonParseException(AStringBuilder::concat(
+                    "unexpected character ", t.getLastCharacter(), " at ", t.getRow(), ":", t.getColumn()));
         };
         auto unexpectedToken = [&](const AString& token) {
-            throw AJsonParseException(
-                    AString("unexpected token ") + token + " at " + AString::number(t.getRow()) + ":"
-                    + AString::number(t.getColumn()));
+            throw AJsonParseException(AStringBuilder::concat(
+                    "unexpected token ", token, " at ", t.getRow(), ":", t.getColumn()));
         };
 
         for (;;) {
             switch (t.readChar()) {
                 case '[': {
-                    aui::impl::JsonArray result;
+                    aui::impl::JsonArray result(resource);
                     while (t.readChar() != ']') {
                         t.reverseByte();
-                        result << read(t);
+                        result << read(t, resource);
                         char c = t.readChar();
                         for (; c != ',' && c != ']'; c = t.readChar()) {
                             if (!isspace(c))
@@ -48,7 +50,7 @@ static AJson read(ATokenizer& t) {
                     return std::move(result);
                 }
                 case '{': {
-                    aui::impl::JsonObject result;
+                    aui::impl::JsonObject result(resource);
                     while (t.readChar() != '}') {
                         if (!isspace(t.getLastCharacter())) {
                             if (t.getLastCharacter() == '\"') {
@@ -61,7 +63,7 @@ static AJson read(ATokenizer& t) {
                                     if (!isspace(c))
                                         unexpectedCharacter();
                                 }
-                                result.emplace_back(std::make_pair(std::move(key), read(t)));
+                                result.emplace_back(std::make_pair(std::move(key), read(t, resource)));
                             } else if (t.getLastCharacter() != ',') {
                                 unexpectedCharacter();
                             }
@@ -136,25 +138,79 @@ static AJson read(ATokenizer& t) {
 }
 
 
+template<typename T>
+static void writeNumber(IOutputStream& os, T value) {
+    // same formatting as AString::number, without transcoding from UTF-16.
+    char buffer[aui::detail::number::MAX_FLOATING_LENGTH];
+    os.write(buffer, aui::detail::number::toChars(buffer, value) - buffer);
+}
+
+/**
+ * @brief Writes the string in quotes, replacing the characters by escape sequences in a single pass.
+ * @param quotesOnly escape only quotes (as done for keys), otherwise backslashes and line breaks too.
+ */
+static void writeQuoted(IOutputStream& os, const AString& value, bool quotesOnly) {
+    std::u16string_view utf16(value.data(), value.size());
+    std::string out;
+    // exact for ASCII without escapes.
+    out.reserve(utf16.size() + 2);
+    out += '"';
+    std::size_t runBegin = 0;
+    auto flushRun = [&](std::size_t runEnd) {
+        auto run = utf16.substr(runBegin, runEnd - runBegin);
+        auto offset = out.size();
+        out.resize(offset + aui::detail::utf::utf8Length(run));
+        aui::detail::utf::utf16ToUtf8(run, out.data() + offset);
+    };
+    for (std::size_t i = 0; i < utf16.size(); ++i) {
+        std::string_view escaped;
+        std::size_t length = 1;
+        switch (utf16[i]) {
+            case u'"':
+                escaped = "\\\"";
+                break;
+            case u'\\':
+                escaped = quotesOnly ? "" : "\\\\";
+                break;
+            case u'\r':
+                if (!quotesOnly && i + 1 < utf16.size() && utf16[i + 1] == u'\n') {
+                    escaped = "\\n";
+                    length = 2;
+                }
+                break;
+            case u'\n':
+                escaped = quotesOnly ? "" : "\\n";
+                break;
+        }
+        if (escaped.empty()) {
+            continue;
+        }
+        flushRun(i);
+        out += escaped;
+        i += length - 1;
+        runBegin = i + 1;
+    }
+    flushRun(utf16.size());
+    out += '"';
+    os.write(out.data(), out.size());
+}
+
 void ASerializable<AJson>::write(IOutputStream& os, const AJson& value) {
     std::visit(aui::lambda_overloaded {
         [&](int v) {
-            os << AString::number(v);
+            writeNumber(os, v);
         },
         [&](int64_t v) {
-            os << AString::number(v);
+            writeNumber(os, v);
         },
         [&](double v) {
-            os << AString::number(v);
+            writeNumber(os, v);
         },
         [&](bool v) {
             os << (v ? "true" : "false");
         },
         [&](const AString& v) {
-            os << '"' << v.replacedAll("\\", "\\\\")
-                .replacedAll("\"", "\\\"")
-                .replacedAll("\r\n", "\\n")
-                .replacedAll("\n", "\\n") << '"';
+            writeQuoted(os, v, false);
         },
         [&](std::nullptr_t) {
             os << "null";
@@ -175,7 +231,8 @@ void ASerializable<AJson>::write(IOutputStream& os, const AJson& value) {
                 if (it != v.begin()) {
                     os << ',';
                 }
-                os << '"' << it->first.replacedAll("\"", "\\\"") << "\":" << it->second;
+                writeQuoted(os, it->first, true);
+                os << ':' << it->second;
             }
             os << '}';
         },
@@ -186,6 +243,14 @@ void ASerializable<AJson>::write(IOutputStream& os, const AJson& value) {
 }
 
 void ASerializable<AJson>::read(IInputStream& is, AJson& dst) {
+    read(is, dst, std::pmr::get_default_resource());
+}
+
+void ASerializable<AJson>::read(IInputStream& is, AJson& dst, std::pmr::memory_resource* resource) {
     ATokenizer t(aui::ptr::fake(&is));
-    dst = ::read(t);
+    auto result = ::read(t, resource);
+    // assignment to an array or object would copy the elements to the resource of dst; move construction keeps
+    // the resource of result.
+    std::destroy_at(&dst);
+    std::construct_at(&dst, std::move(result));
 }
\ No newline at end of file
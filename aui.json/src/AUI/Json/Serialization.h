@@ -18,4 +18,9 @@ template<>
 struct ASerializable<AJson> {
     API_AUI_JSON static void write(IOutputStream& os, const AJson& value);
     API_AUI_JSON static void read(IInputStream& is, AJson& dst);
+
+    /**
+     * @brief Parses json allocating arrays and objects from the specified memory resource.
+     */
+    API_AUI_JSON static void read(IInputStream& is, AJson& dst, std::pmr::memory_resource* resource);
 };
\ No newline at end of file
@@ -14,6 +14,7 @@
 //
 
 #include <gtest/gtest.h>
+#include <AUI/Common/AAtom.h>
 #include <AUI/Common/AString.h>
 #include <AUI/Json/AJson.h>
 #include <AUI/Json/AJson.h>
@@ -54,6 +55,26 @@ TEST(Json, ObjectAssignObject)
     // check for resulting json
     ASSERT_EQ(AJson::toString(root), R"({"user":{"name":"Alex2772","year":2020}})");
 }
+TEST(Json, Utf8String)
+{
+    AUtf8String source = R"({"name":"Алекс","year":2020})";
+    auto o = AJson::fromString(source);
+    EXPECT_EQ(o["name"].asString(), "Алекс");
+    EXPECT_EQ(o["year"].asInt(), 2020);
+    EXPECT_EQ(AJson::toUtf8String(o), source);
+}
+
+TEST(Json, AtomKeys)
+{
+    static const AAtom NAME("name");
+    AJson o;
+    o[NAME] = "Alex2772";
+    EXPECT_TRUE(o.contains(NAME));
+    EXPECT_EQ(o["name"].asString(), "Alex2772");
+    EXPECT_EQ(o[NAME].asString(), "Alex2772");
+    EXPECT_FALSE(o.contains(AAtom("year")));
+}
+
 TEST(Json, StringEscape)
 {
     // arrange data
@@ -69,6 +90,13 @@ TEST(Json, StringEscape)
     EXPECT_EQ(deserialized["user"].asString(), "u\"");
 }
 
+TEST(Json, StringEscapeAll)
+{
+    AJson root;
+    root["k\"ey"] = "Привет\\ \"world\"\r\nline\n";
+    EXPECT_EQ(AJson::toString(root), "{\"k\\\"ey\":\"Привет\\\\ \\\"world\\\"\\nline\\n\"}");
+}
+
 TEST(Json, BraceInitialization)
 {
     // arrange data
@@ -150,3 +178,23 @@ TEST(Json, Utf8Sequence2)
     EXPECT_EQ(v.asArray()[0].asString(), "🤡");
 }
 
+TEST(Json, ParseIntoArena)
+{
+    const std::string_view text = R"({"name":"aui","tags":["ui","c++20"],"nested":{"values":[1,2,3]}})";
+    AArena arena;
+    {
+        auto v = AJson::fromBuffer(AByteBufferView(text.data(), text.size()), &arena);
+        EXPECT_EQ(AJson::toString(v), AJson::toString(AJson::fromString(text)));
+        EXPECT_GT(arena.bytesAllocated(), 0);
+        EXPECT_EQ(v.asObject().get_allocator().resource(), &arena);
+        EXPECT_EQ(v["tags"].asArray().get_allocator().resource(), &arena);
+        EXPECT_EQ(v["nested"]["values"].asArray().get_allocator().resource(), &arena);
+
+        // copies outlive the arena.
+        AJson copy = v["nested"];
+        EXPECT_EQ(copy.asObject().get_allocator().resource(), std::pmr::get_default_resource());
+        EXPECT_EQ(copy["values"].asArray()[2].asInt(), 3);
+    }
+    arena.reset();
+    EXPECT_EQ(arena.bytesAllocated(), 0);
+}
@@ -11,6 +11,7 @@
 
 #include <cassert>
 #include <AUI/Network/ATcpSocket.h>
+#include <AUI/Thread/ABlockingSection.h>
 
 #include "Exceptions.h"
 
@@ -41,6 +42,7 @@ ATcpSocket::~ATcpSocket()
 
 size_t ATcpSocket::read(char* dst, size_t size)
 {
+	ABlockingSection blocking;
 	int res = recv(getHandle(), dst, size, 0);
 	if (res < 0) {
 		handleError("socket read error", res);
@@ -120,8 +120,12 @@ void Lang::run(Toolbox& t) {
                 continue;
             }
 
+            AFlatHashMap<AString, AString> translated;
+            AI18n::loadFromStreamInto(_new<AFileInputStream>(l), translated);
             AMap<AString, AString> dstForThisLang = dst;
-            AI18n::loadFromStreamInto(_new<AFileInputStream>(l), dstForThisLang);
+            for (auto& [key, value] : translated) {
+                dstForThisLang[key] = std::move(value);
+            }
             saveLangFile(l, dstForThisLang);
             std::cout << "updated: " << l << std::endl;
         }
@@ -37,14 +37,14 @@ UIMatcher By::text(const AString& text) {
 UIMatcher By::name(const AString& text) {
     class NameMatcher: public IMatcher {
     private:
-        AString mText;
+        AString mName;
     public:
-        NameMatcher(AString text) : mText(std::move(text)) {}
+        NameMatcher(const AString& text) : mName(text) {}
 
         ~NameMatcher() override = default;
 
         bool matches(const _<AView>& view) override {
-            return view->getAssNames().contains(mText);
+            return view->getAssNames().contains(mName);
         }
     };
     return { _new<NameMatcher>(text) };
@@ -822,6 +822,33 @@ TEST_F(UIDataBindingTest, Declarative_custom_slot3) {
     EXPECT_EQ(label->visibility(), Visibility::INVISIBLE);
 }
 
+TEST_F(UIDataBindingTest, Declarative_next_frame) {
+    using namespace declarative;
+    struct User {
+        AProperty<AString> name;
+    };
+
+    auto user = aui::ptr::manage(new User { .name = "Roza" });
+    auto window = _new<AWindow>();
+    window->setContents(Centered {
+        Label {} & aui::next_frame(user->name)
+    });
+    window->show();
+    auto label = _cast<ALabel>(By::type<ALabel>().one());
+    EXPECT_EQ(label->text(), "Roza");
+
+    int setterCalls = 0;
+    AObject::connect(label->text().changed, label, [&] { setterCalls++; });
+    user->name = "Vasil";
+    user->name = "Kolya";
+    user->name = "World";
+    EXPECT_EQ(label->text(), "Roza"); // deferred until the next frame
+
+    uitest::frame();
+    EXPECT_EQ(label->text(), "World");
+    EXPECT_EQ(setterCalls, 1);
+}
+
 TEST_F(UIDataBindingTest, Declarative_bidirectional_connection) { // HEADER_H2
     // In previous examples, we've used `&` to make one directional (one sided) connection. This is
     // perfectly enough for ALabel because it cannot be changed by user.
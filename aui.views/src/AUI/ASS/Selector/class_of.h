@@ -29,14 +29,19 @@ namespace ass {
     namespace detail {
         struct ClassOf: IAssSubSelector {
         private:
-            AStringVector mClasses;
+            /**
+             * @brief Interned class names; matched against AView::getAssNames by pointer comparison.
+             */
+            AVector<AAtom> mClasses;
             
         public:
-            ClassOf(const AStringVector& classes) : mClasses(classes) {}
-            ClassOf(const AString& clazz) : mClasses({clazz}) {}
+            ClassOf(const AStringVector& classes) : mClasses(classes.begin(), classes.end()) {}
+            ClassOf(const AString& clazz) : mClasses({AAtom(clazz)}) {}
+            ClassOf(AVector<AAtom> classes) : mClasses(std::move(classes)) {}
+            ClassOf(const AAtom& clazz) : mClasses({clazz}) {}
 
             bool isPossiblyApplicable(AView* view) override {
-                for (auto& v : mClasses) {
+                for (const auto& v : mClasses) {
                     if (view->getAssNames().contains(v)) {
                         return true;
                     }
@@ -48,7 +53,7 @@ namespace ass {
                 return isPossiblyApplicable(view);
             }
 
-            const AStringVector& getClasses() const {
+            const AVector<AAtom>& getClasses() const {
                 return mClasses;
             }
         };
@@ -58,6 +63,8 @@ namespace ass {
     public:
         class_of(const AStringVector& classes) : ClassOf(classes) {}
         class_of(const AString& clazz) : ClassOf(clazz) {}
+        class_of(AVector<AAtom> classes) : ClassOf(std::move(classes)) {}
+        class_of(const AAtom& clazz) : ClassOf(clazz) {}
 
         using hover = ass::hovered<detail::ClassOf>;
         using active = ass::activated<detail::ClassOf>;
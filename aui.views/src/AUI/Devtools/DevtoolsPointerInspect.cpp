@@ -186,7 +186,7 @@ void DevtoolsPointerInspect::inspect(AView* ptr) {
     ALogger::info(LOG_TAG) << "Inspecting: " << ptr;
     mResultView->setLayout(std::make_unique<AVerticalLayout>());
     mResultView->addView(Horizontal { Label { "AReflect::name = " }, Label { AReflect::name(ptr) } });
-    mResultView->addView(Horizontal { Label { "Ass names = " }, Label { AStringVector(ptr->getAssNames()).join(", ") } });
+    mResultView->addView(Horizontal { Label { "Ass names = " }, Label { (ptr->getAssNames() | ranges::to<AStringVector>()).join(", ") } });
     auto fake = _new<FakeContainer>(ptr->sharedPtr());
     auto parentHelper = _new<ParentHelper>(fake);
     connect(parentHelper->reinflate, [this](AView* ptr) {
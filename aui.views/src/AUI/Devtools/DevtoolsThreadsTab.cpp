@@ -101,7 +101,7 @@ DevtoolsThreadsTab::DevtoolsThreadsTab(AThreadPool& targetThreadPool) {
         views->addViews({
           _new<ALabel>(thread->threadName()),
           _new<WatcherView>([thread] {
-              return thread->messageQueue().messages().size();
+              return thread->messageQueue().size();
           }) let { connect(mUpdateTimer->fired, slot(it)::update); },
         });
     };
@@ -114,6 +114,70 @@ DevtoolsThreadsTab::DevtoolsThreadsTab(AThreadPool& targetThreadPool) {
       }) let { connect(mUpdateTimer->fired, slot(it)::update); },
     });
 
+    // the snapshot is refreshed before the watchers below are updated since this slot is connected first.
+    struct TelemetryState {
+        AThreadPool::Telemetry previous;
+        AThreadPool::Telemetry current;
+    };
+    auto telemetry = _new<TelemetryState>();
+    telemetry->current = targetThreadPool.telemetry();
+    connect(mUpdateTimer->fired, this, [telemetry, &targetThreadPool] {
+        telemetry->previous = std::move(telemetry->current);
+        telemetry->current = targetThreadPool.telemetry();
+    });
+
+    auto addTelemetry = [&](AString name, std::function<size_t(const TelemetryState&)> observe) {
+        views->addViews({
+          _new<ALabel>(std::move(name)),
+          _new<WatcherView>([telemetry, observe = std::move(observe)] {
+              return observe(*telemetry);
+          }) let { connect(mUpdateTimer->fired, slot(it)::update); },
+        });
+    };
+    using Telemetry = AThreadPool::Telemetry;
+    auto toUs = [](std::chrono::nanoseconds duration) {
+        if (duration == std::chrono::nanoseconds::max()) {
+            return std::numeric_limits<size_t>::max();
+        }
+        return size_t(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+    };
+    // histograms are cumulative; show percentiles of the last timer period only.
+    auto recent = [](const Telemetry::Histogram& current, const Telemetry::Histogram& previous) {
+        Telemetry::Histogram result;
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = current[i] - previous[i];
+        }
+        return result;
+    };
+    addTelemetry("Thread Pool: tasks/s", [](const TelemetryState& t) {
+        return size_t(t.current.tasksPerSecond(t.previous));
+    });
+    addTelemetry("Thread Pool: steals/s", [](const TelemetryState& t) {
+        auto seconds = std::chrono::duration<double>(t.current.timestamp - t.previous.timestamp).count();
+        return seconds > 0 ? size_t(double(t.current.steals - t.previous.steals) / seconds) : 0;
+    });
+    addTelemetry("Thread Pool: longest running task, ms", [](const TelemetryState& t) {
+        return size_t(std::chrono::duration_cast<std::chrono::milliseconds>(t.current.longestRunning).count());
+    });
+    for (const auto& entry : { std::pair { AThreadPool::PRIORITY_HIGHEST, "highest" },
+                               std::pair { AThreadPool::PRIORITY_MEDIUM, "medium" },
+                               std::pair { AThreadPool::PRIORITY_LOWEST, "lowest" } }) {
+        auto priority = entry.first;
+        auto priorityName = entry.second;
+        addTelemetry("Thread Pool: {} queue depth"_format(priorityName), [priority](const TelemetryState& t) {
+            return t.current.priorities[priority].queueDepth;
+        });
+        addTelemetry("Thread Pool: {} wait p95, us"_format(priorityName), [priority, toUs, recent](const TelemetryState& t) {
+            return toUs(Telemetry::percentile(
+                recent(t.current.priorities[priority].waitTime, t.previous.priorities[priority].waitTime), 0.95));
+        });
+        addTelemetry("Thread Pool: {} execution p95, us"_format(priorityName), [priority, toUs, recent](const TelemetryState& t) {
+            return toUs(Telemetry::percentile(
+                recent(t.current.priorities[priority].executionTime, t.previous.priorities[priority].executionTime),
+                0.95));
+        });
+    }
+
     setContents(Stacked { AScrollArea::Builder().withContents(Vertical {
       std::move(views),
     }) });
@@ -81,7 +81,7 @@ void ViewPropertiesView::setTargetView(const _<AView>& targetView) {
             AText::fromString((targetView->getAssNames() | ranges::to<AStringVector>()).join(", ")),
             Horizontal {
               Button { "Add \"DevtoolsTest\" stylesheet name" } let {
-                      it->setEnabled(!targetView->getAssNames().contains("DevtoolsTest"));
+                      it->setEnabled(!targetView->getAssNames().contains(AAtom("DevtoolsTest")));
                       connect(it->clicked, [=] {
                           targetView->addAssName("DevtoolsTest");
                           setTargetView(targetView);
@@ -126,7 +126,7 @@ void ViewPropertiesView::setTargetView(const _<AView>& targetView) {
             AStringVector sl;
             for (auto& ss : r.getSelector().getSubSelectors()) {
                 if (auto classOf = _cast<class_of>(ss)) {
-                    sl << "ass::class_of(\"{}\")"_format(classOf->getClasses().join(", "));
+                    sl << "ass::class_of(\"{}\")"_format((classOf->getClasses() | ranges::to<AStringVector>()).join(", "));
                 } else {
                     sl << IStringable::toString(ss);
                 }
@@ -23,6 +23,7 @@
 #include "AUI/Common/AStringVector.h"
 #include "AFontFamily.h"
 #include <AUI/Common/AByteBuffer.h>
+#include <AUI/Common/AFlatHashMap.h>
 
 class AString;
 
@@ -59,6 +60,16 @@ public:
         bool operator<(const FontKey& f) const {
             return hash() < f.hash();
         }
+
+        bool operator==(const FontKey& f) const {
+            return size == f.size && fr == f.fr;
+        }
+
+        struct Hash {
+            std::size_t operator()(const FontKey& f) const noexcept {
+                return std::size_t(f.hash());
+            }
+        };
     };
 
     struct FontData {
@@ -75,10 +86,21 @@ private:
     AByteBuffer mFontDataBuffer;
     FT_FaceRec_* mFace;
 
-    AMap<FontKey, FontData> mCharData;
+    /**
+     * FontEntry refers to FontData, so FontData is allocated separately and does not move on rehashing.
+     */
+    AFlatHashMap<FontKey, _unique<FontData>, FontKey::Hash> mCharData;
+
+    FontData& getFontData(const FontKey& key) {
+        auto& data = mCharData[key];
+        if (!data) {
+            data = std::make_unique<FontData>();
+        }
+        return *data;
+    }
 
     FontData& getFontEntry(unsigned size, FontRendering fr) {
-        return mCharData[FontKey{size, fr}];
+        return getFontData(FontKey{size, fr});
     }
 
     Character renderGlyph(const FontEntry& fs, long glyph);
@@ -89,7 +111,7 @@ public:
     AFont(AFontManager* fm, const AUrl& url);
 
     FontEntry getFontEntry(const FontKey& key) {
-        return {key, mCharData[key]};
+        return {key, getFontData(key)};
     }
 
     glm::vec2 getKerning(wchar_t left, wchar_t right);
@@ -22,6 +22,7 @@
 #include "AOverlappingSurface.h"
 #include "ADragNDrop.h"
 #include "AUI/Util/ATouchScroller.h"
+#include "AUI/Util/AMessageQueue.h"
 #include "ATouchscreenKeyboardPolicy.h"
 #include <chrono>
 #include <optional>
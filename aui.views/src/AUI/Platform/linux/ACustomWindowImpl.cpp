@@ -63,10 +63,11 @@ void ACustomWindow::handleXConfigureNotify() {
 
 
 bool ACustomWindow::isCaptionAt(const glm::ivec2& pos) {
+    static const AAtom OVERRIDE_TITLE_DRAGGING(".override-title-dragging");
     if (pos.y <= mTitleHeight) {
         if (auto v = getViewAtRecursive(pos)) {
             if (!(_cast<AButton>(v)) &&
-                !v->getAssNames().contains(".override-title-dragging")) {
+                !v->getAssNames().contains(OVERRIDE_TITLE_DRAGGING)) {
                 return true;
             }
         }
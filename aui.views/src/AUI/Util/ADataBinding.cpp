@@ -14,3 +14,14 @@
 //
 
 #include "ADataBinding.h"
+#include <AUI/Platform/AWindowBase.h>
+
+bool aui::detail::enqueueBeforeFrame(AView& view, AMoveOnlyFunction<void(IRenderer&)> callback) {
+    auto window = view.getWindow();
+    if (!window) {
+        return false;
+    }
+    window->beforeFrameQueue().enqueue(std::move(callback));
+    window->flagRedraw();
+    return true;
+}
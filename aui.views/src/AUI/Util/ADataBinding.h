@@ -15,11 +15,14 @@
 #include "ALayoutInflater.h"
 #include <functional>
 #include <type_traits>
+#include <optional>
 #include <AUI/Common/SharedPtr.h>
 #include <AUI/Common/ASignal.h>
+#include <AUI/Common/AMoveOnlyFunction.h>
 #include <AUI/Traits/members.h>
 #include <AUI/View/AViewContainer.h>
 
+class IRenderer;
 
 /**
  * @brief Defines how View handles properties of FieldType type.
@@ -541,6 +544,125 @@ inline const _<Object>& operator&&(const _<Object>& object, Connectable&& bindin
     return object;
 }
 
+namespace aui {
+
+/**
+ * @brief Wraps a readable property to bind it to a view in "apply on next frame" mode.
+ * @ingroup property_system
+ * @details
+ * A binding created by `&` calls the view's setter synchronously on every change of the source property. If the
+ * property changes many times between two frames (i.e., a model updated by a batch of network messages), each change
+ * relayouts the view.
+ *
+ * aui::next_frame defers the setter to the before-frame queue of the view's window and collapses repeated writes to
+ * the last value, so the setter (and the markMinContentSizeInvalid cascade it causes) runs at most once per frame:
+ * @code{cpp}
+ * Label {} & aui::next_frame(model->status)
+ * @endcode
+ *
+ * The current value of the property is applied immediately on connection creation, so the view is laid out with
+ * actual data on its first frame. Changes made while the view is not attached to a window are applied immediately.
+ */
+template <APropertyReadable Property>
+struct next_frame_t {
+    Property property;
+};
+
+/**
+ * @brief Creates "apply on next frame" binding source. See aui::next_frame_t.
+ * @ingroup property_system
+ */
+template <APropertyReadable Property>
+next_frame_t<Property> next_frame(Property&& property) {
+    return { std::forward<Property>(property) };
+}
+
+namespace detail {
+/**
+ * @brief Enqueues the callback to the before-frame queue of the view's window and requests a frame.
+ * @return false if the view is not attached to a window; the callback is dropped in this case.
+ */
+API_AUI_VIEWS bool enqueueBeforeFrame(AView& view, AMoveOnlyFunction<void(IRenderer&)> callback);
+
+template <typename Object, typename Property, typename Apply>
+void connectOnNextFrame(const _<Object>& object, const Property& property, Apply apply) {
+    using Underlying = std::decay_t<decltype(*property)>;
+    struct State {
+        Apply apply;
+        std::optional<Underlying> pending;
+
+        explicit State(Apply apply) : apply(std::move(apply)) {}
+
+        void flush() {
+            std::invoke(apply, *std::exchange(pending, std::nullopt));
+        }
+    };
+
+    /**
+     * @brief Owns the state while the flush is queued. If the flush is dropped without running (i.e., the window was
+     * closed before the frame), clears the pending value so the next change is scheduled again.
+     */
+    struct ScheduledFlush {
+        _<State> state;
+
+        explicit ScheduledFlush(_<State> state) : state(std::move(state)) {}
+        ScheduledFlush(ScheduledFlush&&) noexcept = default;
+        ~ScheduledFlush() {
+            if (state) {
+                state->pending.reset();
+            }
+        }
+    };
+
+    auto state = _new<State>(std::move(apply));
+    std::invoke(state->apply, *property);
+    AObject::connect(property.changed, object.get(), [view = object.get(), state = std::move(state)](const Underlying& value) {
+        if (std::exchange(state->pending, value)) {
+            // already scheduled; the last written value wins.
+            return;
+        }
+        if (!enqueueBeforeFrame(*view, [scheduled = ScheduledFlush(state), self = view->weakPtr()](IRenderer&) mutable {
+            if (self.lock()) {
+                auto state = std::move(scheduled.state);
+                state->flush();
+            }
+        })) {
+            // not attached to a window; the pending value might have been already cleared by ScheduledFlush.
+            state->pending.reset();
+            std::invoke(state->apply, value);
+        }
+    });
+}
+}
+}
+
+template <typename Object, typename Property>
+inline const _<Object>& operator&(const _<Object>& object, aui::next_frame_t<Property>&& binding) {
+    aui::tuple_visitor<
+        typename AAnySignalOrPropertyTraits<std::decay_t<Property>>::args>::for_each_all([&]<typename... T>() {
+        using Binding = ADataBindingDefault<std::decay_t<Object>, std::decay_t<T>...>;
+        static_assert(
+            requires { { Binding::property(object) } -> AAnyProperty; } ||
+                requires { { Binding::property(object) } -> aui::derived_from<ASlotDefBase>; },
+            "ADataBindingDefault is required to have property() function to return any property or slot def; either "
+            "define proper ADataBindingDefault specialization or explicitly specify the destination property.");
+        Binding::setup(object);
+        decltype(auto) destination = Binding::property(object);
+        if constexpr (std::is_reference_v<decltype(destination)>) {
+            aui::detail::connectOnNextFrame(object, binding.property, [&destination](const auto& value) {
+                destination = value;
+            });
+        } else if constexpr (AAnyProperty<decltype(destination)>) {
+            aui::detail::connectOnNextFrame(object, binding.property, [destination = std::move(destination)](const auto& value) mutable {
+                destination = value;
+            });
+        } else {
+            aui::detail::connectOnNextFrame(object, binding.property, std::move(destination.invocable));
+        }
+    });
+    return object;
+}
+
 template <AAnyProperty Lhs, typename Destination>
 struct Binding {
     Lhs sourceProperty;
@@ -64,7 +64,7 @@ void AViewProfiler::displayBoundsOn(AView& v, ARenderContext ctx) {
         auto s = ctx.render.prerenderString({x + 2_dp, y + 1_dp },
                                          v.getAssNames().empty()
                                          ? typeid(v).name()
-                                         : *v.getAssNames().begin() + "\n"_as + AString::number(v.getSize().x) + "x"_as + AString::number(v.getSize().y), fs);
+                                         : v.getAssNames().begin()->str() + "\n"_as + AString::number(v.getSize().x) + "x"_as + AString::number(v.getSize().y), fs);
 
         {
             ctx.render.rectangle(ASolidBrush{0x00000070u},
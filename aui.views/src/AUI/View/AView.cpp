@@ -285,10 +285,11 @@ void AView::pack()
 void AView::addAssName(const AString& assName)
 {
     AUI_ASSERTX(!assName.empty(), "empty ass name");
-    if (mAssNames.contains(assName)) {
+    AAtom atom(assName);
+    if (mAssNames.contains(atom)) {
         return;
     }
-    mAssNames << assName;
+    mAssNames << atom;
     invalidateAssHelper();
 }
 
@@ -301,7 +302,12 @@ void AView::invalidateAssHelper() {
 void AView::removeAssName(const AString& assName)
 {
     AUI_ASSERTX(!assName.empty(), "empty ass name");
-    mAssNames.removeAll(assName);
+    // a name that was never interned can't be in mAssNames; don't intern it.
+    auto atom = AAtom::find(assName);
+    if (!atom) {
+        return;
+    }
+    mAssNames.removeAll(*atom);
     invalidateAssHelper();
 }
 
@@ -812,7 +818,7 @@ void AView::markPixelDataInvalid(ARect<int> invalidArea) {
 }
 
 AString AView::debugString() const {
-    return "{} at {}"_format(mAssNames.empty() ? IStringable::toString(this) : mAssNames.last(), getPositionInWindow());
+    return "{} at {}"_format(mAssNames.empty() ? IStringable::toString(this) : mAssNames.last().str(), getPositionInWindow());
 }
 
 void AView::forceUpdateLayoutRecursively() {
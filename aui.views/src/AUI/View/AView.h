@@ -17,6 +17,7 @@
 
 #include <glm/glm.hpp>
 
+#include "AUI/Common/AAtomVector.h"
 #include "AUI/Common/ASmallVector.h"
 #include <AUI/ASS/Property/IProperty.h>
 #include <AUI/ASS/Property/ScrollbarAppearance.h>
@@ -182,8 +183,14 @@ public:
 
     void popStencilIfNeeded(ARenderContext ctx);
 
+    /**
+     * @brief ASS classes of this view.
+     * @details
+     * Names are interned, so ASS selectors match them by pointer comparison. Looking a name up by a string
+     * (`getAssNames().contains(".name")`) does not intern it.
+     */
     [[nodiscard]]
-    const AVector<AString>& getAssNames() const noexcept {
+    const AAtomVector& getAssNames() const noexcept {
         return mAssNames;
     }
 
@@ -1063,7 +1070,7 @@ protected:
      * @details
      * Needs keeping order.
      */
-    AVector<AString> mAssNames;
+    AAtomVector mAssNames;
 
     /**
      * @brief If set to true, AViewContainer is obligated ignore this view. This value is set to false by
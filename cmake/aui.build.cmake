@@ -343,6 +343,24 @@ macro(aui_enable_benchmarks AUI_MODULE_NAME)
         endif()
         file(GLOB_RECURSE benchmarks_SRCS ${_source_dir}/benchmarks/*.cpp)
 
+        # benchmarks/allocations replace global operator new to count allocations; they are built to a separate
+        # AllocationBenchmarks executable so the replacement does not affect the rest of the benchmarks.
+        list(FILTER benchmarks_SRCS EXCLUDE REGEX "/benchmarks/allocations/")
+        file(GLOB_RECURSE allocation_benchmarks_SRCS ${_source_dir}/benchmarks/allocations/*.cpp)
+        if (allocation_benchmarks_SRCS)
+            if (NOT TARGET AllocationBenchmarks)
+                add_executable(AllocationBenchmarks ${allocation_benchmarks_SRCS})
+                _auib_apply_rpath(AllocationBenchmarks)
+                set_property(TARGET AllocationBenchmarks PROPERTY CXX_STANDARD 20)
+                target_link_libraries(AllocationBenchmarks PUBLIC benchmark::benchmark benchmark::benchmark_main)
+                aui_add_properties(AllocationBenchmarks)
+                set_target_properties(AllocationBenchmarks PROPERTIES EXCLUDE_FROM_ALL 1 EXCLUDE_FROM_DEFAULT_BUILD 1)
+            else()
+                target_sources(AllocationBenchmarks PRIVATE ${allocation_benchmarks_SRCS})
+            endif()
+            aui_link(AllocationBenchmarks PRIVATE ${AUI_MODULE_NAME})
+        endif()
+
         if (NOT TARGET Benchmarks)
             set(benchmarks_MODULE_NAME Benchmarks)
 